@@ -18,6 +18,7 @@ cd minisat
 export MROOT="${PWD}"
 cd core
 make
+make libr
 
 echo "........................."
 echo "Installing glucose"
@@ -29,6 +30,7 @@ tar -xvzf glucose.tgz
 rm glucose.tgz
 cd glucose-syrup-4.1/simp
 make rs
+make libr
 
 echo "........................."
 echo "Compiling AAN-reach"
@@ -42,5 +44,6 @@ mkdir obj/interface
 mkdir obj/lcg
 mkdir obj/logic
 mkdir obj/model
+mkdir obj/sat
 
 make aan_reach
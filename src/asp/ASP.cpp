@@ -11,6 +11,8 @@
 #include <string>
 #include <fstream>
 
+#include "../sat/ScratchFile.hpp"
+
 using namespace std;
 
  /*---------------------------------------------------------------------------*/
@@ -41,7 +43,10 @@ bool ASP::reachability(Context& initContext, Context& finalContext, int length)
 
   res += "#show active/2.\n";
 
-  ofstream file("../expe/TACAS/aspmod.lp");
+  /* unique files: several programs can be solved at the same time */
+  sat::ScratchFile program, result;
+
+  ofstream file(program.name());
 
   if(file) {
     file << res;
@@ -52,14 +57,14 @@ bool ASP::reachability(Context& initContext, Context& finalContext, int length)
 
   /* run clingo */
   string cmd = "./../solver/clingo-4.5.4-linux-x86_64/clingo";
-  cmd += " ../expe/TACAS/aspmod.lp";
-  cmd += " > ../expe/TACAS/asp_res";
+  cmd += " " + program.quotedName();
+  cmd += " > " + result.quotedName();
   // cmd += " --verbose 1";
   int resEx = system(cmd.c_str());
 
   bool reachable = true;
 
-  ifstream out("../expe/TACAS/asp_res");
+  ifstream out(result.name());
 
   if(out) {
 
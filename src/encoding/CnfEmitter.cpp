@@ -0,0 +1,404 @@
+/*!
+ * \file CnfEmitter.cpp
+ * \brief implementation of the CnfEmitter class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include "CnfEmitter.hpp"
+
+#include <iostream>
+#include <cstdlib>
+
+#include "../interface/Parameters.hpp"
+
+using namespace std;
+
+/*----------------------------------------------------------------------------*/
+CnfEmitter::CnfEmitter(AN& an, cnf::CnfExpression& cnfEx):
+_an(an),
+_cnfEx(cnfEx),
+_cardinality(cnfEx, Parameters::getParameters().atMostOne)
+{
+    Parameters& param = Parameters::getParameters();
+    _steps = param.steps;
+    /* the parallel steps are defined on the transition selectors */
+    _selector = (param.transitionEncoding == Parameters::selector || _steps != Parameters::interleaving);
+    chooseCodings();
+}
+
+/*----------------------------------------------------------------------------*/
+void CnfEmitter::chooseCodings() {
+
+    Parameters& param = Parameters::getParameters();
+
+    _coding.resize(_an.nAutomata(), OneHot);
+
+    vector<int> nCoding(3, 0);
+
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+
+        int nState = _an.getAutomaton(autInd).nState;
+
+        if(param.stateEncoding == Parameters::logarithmic) {
+            _coding.at(autInd) = Log;
+        } else if(param.stateEncoding == Parameters::order) {
+            _coding.at(autInd) = Order;
+        } else if(param.stateEncoding == Parameters::automatic) {
+            /* one variable is enough for boolean automata, the ladder avoids long guards for many levels */
+            if(nState <= 2) {
+                _coding.at(autInd) = Log;
+            } else if(nState >= 6) {
+                _coding.at(autInd) = Order;
+            }
+        }
+
+        nCoding.at(_coding.at(autInd)) ++;
+    }
+
+    if(param.debugLevel > 0) {
+        cout << "state codings: " << nCoding.at(OneHot) << " one-hot, " << nCoding.at(Log) << " log, " << nCoding.at(Order) << " order" << endl;
+    }
+
+}
+
+/*----------------------------------------------------------------------------*/
+int CnfEmitter::length() {
+    return static_cast<int>(_variables.size());
+}
+
+/*----------------------------------------------------------------------------*/
+vector<int> CnfEmitter::state(int k, int autInd, int stateInd) {
+
+    vector<int>& var = _variables.at(k).at(autInd);
+    vector<int> res;
+
+    if(_coding.at(autInd) == OneHot) {
+        res.push_back(var.at(stateInd));
+    } else if(_coding.at(autInd) == Log) {
+        /* binary representation of the state index */
+        for(unsigned int bit = 0; bit < var.size(); bit ++) {
+            res.push_back(cnf::literal(var.at(bit), ((stateInd >> bit) & 1) == 1));
+        }
+    } else {
+        /* the variable i is true iff the state index is greater than i */
+        if(stateInd > 0) {
+            res.push_back(var.at(stateInd-1));
+        }
+        if(stateInd < static_cast<int>(var.size())) {
+            res.push_back(cnf::literal(var.at(stateInd), false));
+        }
+    }
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+void CnfEmitter::addNotState(vector<int>& clause, int k, int autInd, int stateInd) {
+    for(int lit : state(k, autInd, stateInd)) {
+        clause.push_back(-lit);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void CnfEmitter::addGlobalState() {
+
+    int k = length();
+
+    _variables.push_back(vector<vector<int>>(_an.nAutomata()));
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+
+        int nState = _an.getAutomaton(autInd).nState;
+        int nVar = nState;
+
+        if(_coding.at(autInd) == Log) {
+            nVar = 0;
+            while((1 << nVar) < nState) {
+                nVar ++;
+            }
+        } else if(_coding.at(autInd) == Order) {
+            nVar = nState-1;
+        }
+
+        for(int ind = 0; ind < nVar; ind ++) {
+            _variables.at(k).at(autInd).push_back(_cnfEx.addVariable());
+        }
+    }
+    _noChange.push_back(vector<int>(_an.nAutomata(), 0));
+    _fired.push_back(vector<vector<int>>(_an.nAutomata()));
+
+    activateState(k);
+
+    if(k > 0) {
+        createTransition(k);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void CnfEmitter::setContext(int k, Context& context) {
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        if(context.at(autInd) == -1) {
+            continue;
+        }
+        if(_coding.at(autInd) == OneHot) {
+            for(int stateInd = 0; stateInd < _an.getAutomaton(autInd).nState; stateInd ++) {
+                _cnfEx.addClause({cnf::literal(_variables.at(k).at(autInd).at(stateInd), stateInd == context.at(autInd))});
+            }
+        } else {
+            for(int lit : state(k, autInd, context.at(autInd))) {
+                _cnfEx.addClause({lit});
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void CnfEmitter::assumeContext(sat::Solver& solver, int k, Context& context) {
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        if(context.at(autInd) == -1) {
+            continue;
+        }
+        if(_coding.at(autInd) == OneHot) { /* the other local states are disabled too */
+            for(int stateInd = 0; stateInd < _an.getAutomaton(autInd).nState; stateInd ++) {
+                solver.assume(cnf::literal(_variables.at(k).at(autInd).at(stateInd), stateInd == context.at(autInd)));
+            }
+        } else {
+            for(int lit : state(k, autInd, context.at(autInd))) {
+                solver.assume(lit);
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+bool CnfEmitter::stateValue(sat::Solver& solver, int k, int autInd, int stateInd) {
+    bool res = true;
+    for(int lit : state(k, autInd, stateInd)) {
+        if(solver.value(abs(lit)) != (lit > 0)) {
+            res = false;
+        }
+    }
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+void CnfEmitter::activateState(int k) {
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+
+        vector<int>& var = _variables.at(k).at(autInd);
+
+        if(_coding.at(autInd) == OneHot) {
+            if(k == 0) {
+                /* exactly one local state in the first global state, the transitions keep it in the next ones */
+                _cardinality.exactlyOne(var);
+            } else {
+                /* at least one of the local states must be true */
+                _cardinality.atLeastOne(var);
+            }
+        } else if(_coding.at(autInd) == Log) {
+            /* forbid the binary codes that are not a local state */
+            for(int code = _an.getAutomaton(autInd).nState; code < (1 << var.size()); code ++) {
+                vector<int> clause;
+                addNotState(clause, k, autInd, code);
+                _cnfEx.addClause(clause);
+            }
+        } else {
+            /* the ladder: greater than i+1 implies greater than i */
+            for(int ind = 0; ind+1 < static_cast<int>(var.size()); ind ++) {
+                _cnfEx.addClause({cnf::literal(var.at(ind+1), false), var.at(ind)});
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void CnfEmitter::createTransition(int k) {
+    if(_selector) {
+        selectorTransition(k);
+        return;
+    }
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        for(int stateInd = 0; stateInd < _an.getAutomaton(autInd).nState; stateInd ++) {
+            activationRule(k, autInd, stateInd);
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void CnfEmitter::selectorTransition(int k) {
+
+    vector<int> allFired;
+
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+
+        Automaton& aut = _an.getAutomaton(autInd);
+
+        /* frame axiom: the automaton is not modified or one of its transitions is fired */
+        vector<int> frame;
+        frame.push_back(noChange(k, autInd));
+
+        for(auto& trans : aut.transitions) {
+
+            int fired = _cnfEx.addVariable();
+            _fired.at(k).at(autInd).push_back(fired);
+            allFired.push_back(fired);
+            frame.push_back(fired);
+
+            /* guard in the previous global state */
+            for(int lit : state(k-1, autInd, trans.origin)) {
+                _cnfEx.addClause({cnf::literal(fired, false), lit});
+            }
+            for(auto condPair : trans.conditions) {
+                for(int lit : state(k-1, condPair.first, condPair.second)) {
+                    _cnfEx.addClause({cnf::literal(fired, false), lit});
+                }
+            }
+
+            /* effect in the new global state */
+            if(_coding.at(autInd) == OneHot) {
+                for(int stateInd = 0; stateInd < aut.nState; stateInd ++) {
+                    _cnfEx.addClause({cnf::literal(fired, false), cnf::literal(_variables.at(k).at(autInd).at(stateInd), stateInd == trans.target)});
+                }
+            } else {
+                for(int lit : state(k, autInd, trans.target)) {
+                    _cnfEx.addClause({cnf::literal(fired, false), lit});
+                }
+            }
+        }
+
+        _cnfEx.addClause(frame);
+    }
+
+    if(_steps == Parameters::interleaving) {
+        /* asynchronous semantics: at most one transition at a time */
+        _cardinality.atMostOne(allFired);
+        return;
+    }
+
+    /* parallel steps: at most one transition per automaton, the mover variable is true if the automaton fires */
+    vector<int> mover(_an.nAutomata(), 0);
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        _cardinality.atMostOne(_fired.at(k).at(autInd));
+        if(!_fired.at(k).at(autInd).empty()) {
+            mover.at(autInd) = _cnfEx.addVariable();
+            for(auto fired : _fired.at(k).at(autInd)) {
+                _cnfEx.addClause({cnf::literal(fired, false), mover.at(autInd)});
+            }
+        }
+    }
+
+    /* a transition cannot fire with a transition of an automaton read in its guard:
+     * in any order for the forall-steps, before it in the automata order for the exists-steps */
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        Automaton& aut = _an.getAutomaton(autInd);
+        for(unsigned int trInd = 0; trInd < aut.transitions.size(); trInd ++) {
+            for(auto condPair : aut.transitions.at(trInd).conditions) {
+                int autInd2 = condPair.first;
+                if(autInd2 == autInd || mover.at(autInd2) == 0) {
+                    continue;
+                }
+                if(_steps == Parameters::forall || autInd2 < autInd) {
+                    _cnfEx.addClause({cnf::literal(_fired.at(k).at(autInd).at(trInd), false), cnf::literal(mover.at(autInd2), false)});
+                }
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void CnfEmitter::activationRule(int k, int autInd, int stateInd) {
+
+    Automaton& aut = _an.getAutomaton(autInd);
+
+    /* list of the transitions */
+    vector<Transition*> transitions;
+
+    for(auto& transition : aut.transitions) {
+        if(transition.target == stateInd) {
+            transitions.push_back(&transition);
+        }
+    }
+
+    /* the local state is active: it was already active, or a transition is done */
+    vector<int> rule;
+    addNotState(rule, k, autInd, stateInd);
+
+    if(_coding.at(autInd) == OneHot) {
+        rule.push_back(_variables.at(k-1).at(autInd).at(stateInd));
+    } else { /* the state is kept iff the variables of the automaton are not modified */
+        rule.push_back(noChange(k, autInd));
+    }
+
+    if(transitions.empty()) { /* the local state can only be kept */
+        _cnfEx.addClause(rule);
+        return;
+    }
+
+    int change = _cnfEx.addVariable();
+    rule.push_back(change);
+    _cnfEx.addClause(rule);
+
+    /* transition choice, make sure the transition is playable */
+    if(transitions.size() == 1) {
+        Transition* trans = transitions.at(0);
+        for(int lit : state(k-1, autInd, trans->origin)) {
+            _cnfEx.addClause({cnf::literal(change, false), lit});
+        }
+        for(auto condPair : trans->conditions) {
+            for(int lit : state(k-1, condPair.first, condPair.second)) {
+                _cnfEx.addClause({cnf::literal(change, false), lit});
+            }
+        }
+    } else {
+        /* choose at least one transition, the conditions of the transition are verified */
+        vector<int> choice;
+        choice.push_back(cnf::literal(change, false));
+        for(auto trans : transitions) {
+            int guard = _cnfEx.addVariable();
+            choice.push_back(guard);
+            for(int lit : state(k-1, autInd, trans->origin)) {
+                _cnfEx.addClause({cnf::literal(guard, false), lit});
+            }
+            for(auto condPair : trans->conditions) {
+                for(int lit : state(k-1, condPair.first, condPair.second)) {
+                    _cnfEx.addClause({cnf::literal(guard, false), lit});
+                }
+            }
+        }
+        _cnfEx.addClause(choice);
+    }
+
+    /* make sure the local states of the other automata are not modified */
+    for(int autInd2 = 0; autInd2 < _an.nAutomata(); autInd2 ++) {
+        if(autInd2 != autInd) {
+            _cnfEx.addClause({cnf::literal(change, false), noChange(k, autInd2)});
+        }
+    }
+
+    /* make sure the other local states of the same automaton are not activated, implicit if only one state can be coded */
+    if(_coding.at(autInd) == OneHot) {
+        for(int stateInd2 = 0; stateInd2 < aut.nState; stateInd2 ++) {
+            if(stateInd2 != stateInd) {
+                _cnfEx.addClause({cnf::literal(change, false), cnf::literal(_variables.at(k).at(autInd).at(stateInd2), false)});
+            }
+        }
+    }
+
+}
+
+/*----------------------------------------------------------------------------*/
+int CnfEmitter::noChange(int k, int autInd) {
+    if(_noChange.at(k).at(autInd) == 0) {
+        int var = _cnfEx.addVariable();
+        vector<int>& prev = _variables.at(k-1).at(autInd);
+        vector<int>& cur = _variables.at(k).at(autInd);
+        for(unsigned int ind = 0; ind < cur.size(); ind ++) {
+            _cnfEx.addClause({cnf::literal(var, false), cnf::literal(prev.at(ind), false), cur.at(ind)});
+            if(_selector || _coding.at(autInd) != OneHot) { /* each variable keeps its value */
+                _cnfEx.addClause({cnf::literal(var, false), prev.at(ind), cnf::literal(cur.at(ind), false)});
+            }
+        }
+        _noChange.at(k).at(autInd) = var;
+    }
+    return _noChange.at(k).at(autInd);
+}
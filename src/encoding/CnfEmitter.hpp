@@ -0,0 +1,157 @@
+/*!
+ * \file CnfEmitter.hpp
+ * \brief direct generation of the clauses of the BMC unrolling
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef CNF_EMITTER_HPP
+#define CNF_EMITTER_HPP
+
+#include "../model/AN.hpp"
+
+#include "../logic/CnfExpression.hpp"
+#include "../logic/Cardinality.hpp"
+
+#include "../sat/Solver.hpp"
+
+#include "../interface/Parameters.hpp"
+
+/*!
+ * \class CnfEmitter
+ * \brief write the clauses of the path into a cnf expression, without building a logical expression first
+ */
+class CnfEmitter {
+
+    public:
+
+        /* coding of the local states of an automaton */
+        enum Coding {OneHot, Log, Order};
+
+    public:
+
+        /*!
+         * \brief constructor
+         * \param an the automata network
+         * \param cnfEx the cnf expression receiving the clauses
+         */
+        CnfEmitter(AN& an, cnf::CnfExpression& cnfEx);
+
+        /*!
+         * \brief add a global state at the end of the path, with the transition from the previous state
+         */
+        void addGlobalState();
+
+        /*!
+         * \brief number of global states in the path
+         * \return the number of global states
+         */
+        int length();
+
+        /*!
+         * \brief add a context constraint on a global state
+         * \param k index of the global state in the path
+         * \param context the context
+         */
+        void setContext(int k, Context& context);
+
+        /*!
+         * \brief assume a context on a global state for the next solver call
+         * \param solver the SAT solver
+         * \param k index of the global state in the path
+         * \param context the context
+         */
+        void assumeContext(sat::Solver& solver, int k, Context& context);
+
+        /*!
+         * \brief value of a local state in the model found by the solver
+         * \param solver the SAT solver
+         * \param k index of the global state in the path
+         * \param autInd the automaton index
+         * \param stateInd the state index
+         * \return true iff the local state is active
+         */
+        bool stateValue(sat::Solver& solver, int k, int autInd, int stateInd);
+
+    private:
+
+        /*!
+         * \brief choose the coding of each automaton
+         */
+        void chooseCodings();
+
+        /*!
+         * \brief restrict the variables of a global state to valid local states
+         * \param k index of the global state
+         */
+        void activateState(int k);
+
+        /*!
+         * \brief create the activation rules of all the local states of a global state
+         * \param k index of the global state, the transition starts from k-1
+         */
+        void createTransition(int k);
+
+        /*!
+         * \brief create the transition with one selector variable per network transition
+         * \param k index of the global state, the transition starts from k-1
+         */
+        void selectorTransition(int k);
+
+        /*!
+         * \brief create an activation rule for a local state during a transition
+         * \param k index of the global state of the rule
+         * \param autInd the index of the automaton of the rule
+         * \param stateInd the index of the state of the rule
+         */
+        void activationRule(int k, int autInd, int stateInd);
+
+        /*!
+         * \brief get the variable implying that an automaton is not modified
+         * \param k index of the global state, after the transition
+         * \param autInd the automaton index
+         * \return the variable, created with its clauses if necessary
+         */
+        int noChange(int k, int autInd);
+
+        /*!
+         * \brief literals of a local state, the local state is active iff all of them are true
+         * \param k index of the global state
+         * \param autInd the automaton index
+         * \param stateInd the state index
+         * \return the literals
+         */
+        std::vector<int> state(int k, int autInd, int stateInd);
+
+        /*!
+         * \brief add the literals of a local state to a clause, negated
+         * \param clause the clause
+         * \param k index of the global state
+         * \param autInd the automaton index
+         * \param stateInd the state index
+         */
+        void addNotState(std::vector<int>& clause, int k, int autInd, int stateInd);
+
+    private:
+
+        AN& _an; /* automata network to analyse */
+
+        cnf::CnfExpression& _cnfEx; /* clauses of the path */
+
+        cnf::Cardinality _cardinality; /* at most one constraints of the local states and of the transition selectors */
+
+        std::vector<Coding> _coding; /* coding of the local states of each automaton */
+
+        std::vector<std::vector<std::vector<int>>> _variables; /* variables of each automaton in each global state */
+
+        std::vector<std::vector<int>> _noChange; /* no change variables */
+
+        bool _selector; /* one variable per transition fired instead of activation rules */
+
+        Parameters::StepSemantics _steps; /* number of transitions fired at each step */
+
+        std::vector<std::vector<std::vector<int>>> _fired; /* transition fired before each global state, selector encoding */
+
+};
+
+#endif /* CNF_EMITTER_HPP */
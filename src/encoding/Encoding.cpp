@@ -7,10 +7,18 @@
 
 #include <iostream>
 #include <cstdlib>
-#include <fstream>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "Encoding.hpp"
 
+#include "../sat/PreprocessedSolver.hpp"
+#include "../sat/PortfolioSolver.hpp"
+
+#include "../logic/Cardinality.hpp"
+
 #include "../interface/Parameters.hpp"
 
 using namespace std;
@@ -18,12 +26,22 @@ using namespace std;
 /*----------------------------------------------------------------------------*/
 Encoding::Encoding(AN& an):
 _an(an),
+_solver(nullptr),
+_emitter(nullptr),
 _verbose(false),
-_extractSolution(false)
+_extractSolution(false),
+_limited(false),
+_cancel(nullptr)
 {
 
 }
 
+/*----------------------------------------------------------------------------*/
+Encoding::~Encoding() {
+    delete _emitter;
+    delete _solver;
+}
+
 /*----------------------------------------------------------------------------*/
 void Encoding::setVerbose(bool activate) {
     _verbose = activate;
@@ -34,14 +52,20 @@ void Encoding::setExtractSolution(bool extract) {
   _extractSolution = extract;
 }
 
+/*----------------------------------------------------------------------------*/
+void Encoding::setCancel(const atomic<bool>* cancel) {
+  _cancel = cancel;
+}
+
 /*----------------------------------------------------------------------------*/
 void Encoding::createPathVariables(int length) {
     for(int k = 0; k < length; k++) {
         _variables.push_back(StateVar());
+        StateVar& stateVar = _variables.back();
         for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
-            _variables.at(k).push_back(vector<Variable*>());
+            stateVar.push_back(vector<Variable*>());
             for(int stateInd = 0; stateInd < _an.getAutomaton(autInd).nState; stateInd ++) {
-                _variables.at(k).at(autInd).push_back(new Variable(_ex));
+                stateVar.at(autInd).push_back(new(_ex) Variable(_ex));
             }
         }
     }
@@ -53,8 +77,10 @@ void Encoding::setContext(StateVar& stateVar, Context& context) {
         for(int stateInd = 0; stateInd < static_cast<int>(stateVar.at(autInd).size()); stateInd ++) {
             if(stateInd == context.at(autInd)) { /* the variable must be true */
                 _termList.push_back(stateVar.at(autInd).at(stateInd));
+                _ex.setConstant(stateVar.at(autInd).at(stateInd), true);
             } else if(context.at(autInd) != -1) { /* the variable must be false */
-                _termList.push_back(new NotOp(stateVar.at(autInd).at(stateInd)));
+                _termList.push_back(_ex.notOp(stateVar.at(autInd).at(stateInd)));
+                _ex.setConstant(stateVar.at(autInd).at(stateInd), false);
             }
         }
     }
@@ -68,19 +94,15 @@ void Encoding::activateState(StateVar& stateVar) {
             termList2.push_back(var);
         }
         /* at list one of the local state must be true */
-        _termList.push_back(new OrOp(termList2));
+        _termList.push_back(_ex.orOp(termList2));
     }
 }
 
 /*----------------------------------------------------------------------------*/
-void Encoding::avoidConflict(StateVar& stateVar) {
+void Encoding::avoidConflict(int k) {
+    cnf::Cardinality cardinality(_cnfEx, Parameters::getParameters().atMostOne);
     for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
-        auto aut = _an.getAutomaton(autInd);
-        for(int s1 = 0; s1 < aut.nState-1; s1 ++) {
-            for(int s2 = s1+1; s2 < aut.nState; s2 ++) {
-                _termList.push_back(new NotOp(new AndOp({stateVar.at(autInd).at(s1), stateVar.at(autInd).at(s2)})));
-            }
-        }
+        cardinality.atMostOne(_pathCnfVar.at(k).at(autInd));
     }
 }
 
@@ -135,9 +157,9 @@ void Encoding::activationRule(StateVar& sv1, StateVar& sv2, int autInd, int stat
                     cond.push_back(sv1.at(condPair.first).at(condPair.second));
                 }
                 /* choose at least one condition */
-                condNode.push_back(new AndOp(cond));
+                condNode.push_back(_ex.andOp(cond));
             }
-            transNode.push_back(new OrOp(condNode));
+            transNode.push_back(_ex.orOp(condNode));
         }
 
         /* make sure the local states of the other automatas are not modified */
@@ -150,16 +172,16 @@ void Encoding::activationRule(StateVar& sv1, StateVar& sv2, int autInd, int stat
         /* make sure the other local states of the same automata are not activated */
         for(int stateInd2 = 0; stateInd2 < aut.nState; stateInd2 ++) {
             if(stateInd2 != stateInd) {
-                transNode.push_back(new NotOp(sv2.at(autInd).at(stateInd2)));
+                transNode.push_back(_ex.notOp(sv2.at(autInd).at(stateInd2)));
             }
         }
 
         /* create the final node : a transition is done or the same state is kept */
-        actMode = new OrOp({sv1.at(autInd).at(stateInd), new AndOp(transNode)});
+        actMode = _ex.orOp({sv1.at(autInd).at(stateInd), _ex.andOp(transNode)});
     }
 
     /* global node : imply */
-    _termList.push_back(new ImplyOp(sv2.at(autInd).at(stateInd), actMode));
+    _termList.push_back(_ex.implyOp(sv2.at(autInd).at(stateInd), actMode));
 
 }
 
@@ -170,11 +192,11 @@ void Encoding::statesDiff(StateVar& sv1, StateVar& sv2) {
     for(unsigned int autInd = 0; autInd < sv1.size(); autInd ++) {
         vector<Term*> andNode;
         for(unsigned int stateInd = 0; stateInd < sv1.at(autInd).size(); stateInd ++) {
-            andNode.push_back(new ImplyOp(sv1.at(autInd).at(stateInd), new NotOp(sv2.at(autInd).at(stateInd))));
+            andNode.push_back(_ex.implyOp(sv1.at(autInd).at(stateInd), _ex.notOp(sv2.at(autInd).at(stateInd))));
         }
-        orNode.push_back(new AndOp(andNode));
+        orNode.push_back(_ex.andOp(andNode));
     }
-    _termList.push_back(new OrOp(orNode));
+    _termList.push_back(_ex.orOp(orNode));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -192,150 +214,389 @@ AndOp* Encoding::noChange(int k, int autInd) {
         auto aut = _an.getAutomaton(autInd);
         vector<Term*> nodeList(aut.nState);
         for(int stateInd = 0; stateInd < aut.nState; stateInd ++) {
-            nodeList.at(stateInd) = new ImplyOp(_variables.at(k-1).at(autInd).at(stateInd), _variables.at(k).at(autInd).at(stateInd));
+            nodeList.at(stateInd) = _ex.implyOp(_variables.at(k-1).at(autInd).at(stateInd), _variables.at(k).at(autInd).at(stateInd));
         }
-        _noChange.at(k).at(autInd) = new AndOp(nodeList);
+        _noChange.at(k).at(autInd) = _ex.andOp(nodeList);
     }
     return _noChange.at(k).at(autInd);
 }
 
 /*----------------------------------------------------------------------------*/
 void Encoding::disableState(StateVar& stateVar, int autInd, int stateInd) {
-  _termList.push_back(new NotOp(stateVar.at(autInd).at(stateInd)));
+  _termList.push_back(_ex.notOp(stateVar.at(autInd).at(stateInd)));
 }
 
 /*----------------------------------------------------------------------------*/
-bool Encoding::reachability(Context& initCtx, Context& finalCtx, int length) {
+void Encoding::disableContext(StateVar& stateVar, Context& context) {
+
+  vector<Term*> termList2;
+  for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+    if(context.at(autInd) != -1) {
+      termList2.push_back(stateVar.at(autInd).at(context.at(autInd)));
+    }
+  }
+
+  if(termList2.size() == 1) {
+    _termList.push_back(_ex.notOp(termList2.front()));
+  } else {
+    _termList.push_back(_ex.notOp(_ex.andOp(termList2)));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+sat::Result Encoding::reachability(Context& initCtx, Context& finalCtx, int length) {
 
     Parameters& param = Parameters::getParameters();
 
-    if(param.debugLevel > 0) {
-      cout << "create logical variables" << endl;
-    }
+    startQuery();
 
-    createPathVariables(length);
+    createSolver(!param.tree, false);
 
     if(param.debugLevel > 0) {
-      cout << "init the noChange vector" << endl;
+      cout << "create the path" << endl;
     }
-    _noChange.resize(length, vector<AndOp*>(_an.nAutomata(), nullptr));
 
-    if(param.debugLevel > 0) {
-      cout << "set contexts" << endl;
+    /* each step is converted and given to the solver before the next one is created */
+    /* the contexts are fixed before the conversion of their global state: their values simplify the transitions */
+    for(int k = 0; k < length; k++) {
+        if(interrupted()) { /* the path is not needed anymore */
+            return sat::Unknown;
+        }
+        addGlobalState();
+        if(k == 0) {
+            fixContext(0, initCtx);
+        }
+        if(k == length-1) {
+            if(param.debugLevel > 0) {
+              cout << "set final context" << endl;
+            }
+            fixContext(length-1, finalCtx);
+        }
+        convertTerms();
     }
 
-    // Context initCtx, finalCtx;
-    // convertContext(strInitContext, initCtx);
-    // convertContext(strFinalContext, finalCtx);
+    return solve(length);
+}
+
+/*----------------------------------------------------------------------------*/
+sat::Result Encoding::deepening(Context& initCtx, Context& finalCtx, int maxLength, int& length) {
+
+    Parameters& param = Parameters::getParameters();
+
+    startQuery();
+
+    /* the same solver is used for all the lengths, it keeps its clauses and learned clauses */
+    createSolver(!param.tree, true);
 
-    setContext(_variables.at(0), initCtx);
-    setContext(_variables.at(length-1), finalCtx);
+    /* first global state: the initial context */
+    addGlobalState();
+    fixContext(0, initCtx);
+    convertTerms();
+
+    length = 1;
+    sat::Result res = sat::Unknown;
+    bool stop = false;
+
+    while(!stop) {
+
+        if(param.debugLevel > 0) {
+          cout << "path length: " << length << endl;
+        }
+
+        /* the final context is only assumed on the last global state */
+        assumeContext(length-1, finalCtx);
+
+        res = callSolver();
+
+        if(extractSolution(res, length)) {
+            stop = true;
+        } else if(res != sat::Unsat || (maxLength > 0 && length >= maxLength)) {
+            stop = true;
+        } else { /* unroll one more step */
+            addGlobalState();
+            convertTerms();
+            length ++;
+        }
+
+    }
 
     if(param.debugLevel > 0) {
-      cout << "activate states" << endl;
+      cout << "nVar : " << _cnfEx.nVar() << endl;
+      cout << "nClause : " << _cnfEx.nClause() << endl;
     }
-    for(int k = 0; k < length; k++) {
-        activateState(_variables.at(k));
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+sat::Result Encoding::query(Context& initCtx, Context& finalCtx, int length) {
+
+    Parameters& param = Parameters::getParameters();
+
+    startQuery();
+
+    /* the path and the solver are kept for the next queries */
+    if(_solver == nullptr) {
+        createSolver(!param.tree, true);
     }
 
-    if(param.debugLevel > 0) {
-      cout << "create transitions" << endl;
+    return solveAssumed(initCtx, finalCtx, length);
+}
+
+/*----------------------------------------------------------------------------*/
+sat::Result Encoding::queryDeepening(Context& initCtx, Context& finalCtx, int maxLength, int& length) {
+
+    Parameters& param = Parameters::getParameters();
+
+    /* one deadline for all the lengths */
+    startQuery();
+
+    if(_solver == nullptr) {
+        createSolver(!param.tree, true);
     }
-    for(int k = 0; k < length-1; k ++) {
-        createTransition(_variables.at(k), _variables.at(k+1), k+1);
+
+    length = 1;
+    sat::Result res = sat::Unknown;
+    bool stop = false;
+
+    while(!stop) {
+
+        if(param.debugLevel > 0) {
+          cout << "path length: " << length << endl;
+        }
+
+        res = solveAssumed(initCtx, finalCtx, length);
+
+        if(res != sat::Unsat || (maxLength > 0 && length >= maxLength)) {
+            stop = true;
+        } else {
+            length ++;
+        }
     }
 
-    // cout << "alldiff" << endl;
-    // allDiff(_variables);
+    return res;
+}
 
-    // cout << "avoid conflict" << endl;
-    // avoidConflict(_variables.at(0));
+/*----------------------------------------------------------------------------*/
+sat::Result Encoding::solveAssumed(Context& initCtx, Context& finalCtx, int length) {
 
-    if(param.debugLevel > 0) {
-      cout << "settle main term" << endl;
+    while(pathLength() < length) {
+        addGlobalState();
     }
+    convertTerms();
 
-    _ex.setMainTerm(new AndOp(_termList));
+    assumeContext(0, initCtx);
+    assumeContext(length-1, finalCtx);
 
-    vector<cnf::Variable*> cnfVar;
+    sat::Result answer = callSolver();
 
-    cnf::CnfExpression cnfEx;
+    extractSolution(answer, length);
 
-    if(param.debugLevel > 0) {
-      cout << "convert to cnf" << endl;
+    return answer;
+}
+
+/*----------------------------------------------------------------------------*/
+void Encoding::createSolver(bool direct, bool incremental) {
+
+    Parameters& param = Parameters::getParameters();
+
+    /* the clauses are given to the solver while they are created, they are not kept in the encoding */
+    if(param.portfolio.size() > 1) {
+        _solver = new sat::PortfolioSolver(param.portfolio);
+    } else {
+        _solver = sat::Solver::create(param.portfolio.empty() ? param.solver : param.portfolio.front());
     }
-    _ex.toCnf(cnfEx, cnfVar);
-    cnfEx.exportDimacs("temp.dm");
 
-    if(param.debugLevel > 0) {
-      cout << "nVar : " << cnfEx.nVar() << endl;
-      cout << "nClause : " << cnfEx.nClause() << endl;
+    /* the preprocessing removes variables: the formula must be complete when it is solved */
+    if(param.preprocess && !incremental) {
+        _solver = new sat::PreprocessedSolver(_solver);
+    }
+    _cnfEx.setSolver(_solver, false);
 
-      cout << "sat solver lunched" << endl;
+    if(direct) {
+        _emitter = new CnfEmitter(_an, _cnfEx);
     }
+}
 
-    /* command for calling SAT solver */
-    string cmd;
+/*----------------------------------------------------------------------------*/
+void Encoding::addGlobalState() {
+
+    if(_emitter != nullptr) {
+        _emitter->addGlobalState();
+    } else {
+        int k = static_cast<int>(_variables.size());
+        createPathVariables(1);
+        _noChange.resize(k+1, vector<AndOp*>(_an.nAutomata(), nullptr));
+        activateState(_variables.at(k));
+        if(k > 0) {
+            createTransition(_variables.at(k-1), _variables.at(k), k);
+        }
+        if(k > 0 && !_possible.empty()) {
+            propagateStates();
+            setConstants(_variables.at(k));
+        }
+    }
+}
 
-    // if(param.solver == Parameters::glucose) {
-    //   cmd = "./solver/glucose-syrup-4.1/simp/glucose_static";
-    // } else if(param.solver == Parameters::minisat) {
-    //   cmd = "./solver/minisat/core/minisat_static";
-    // } else if(param.solver == Parameters::ccanr) {
-    //   cmd = "./solver/CCAnr_2_cai_source_code/CCAnr";
-    // } else { /* minisat anyway */
-    //   cmd = "./solver/minisat/core/minisat_static";
-    // }
+/*----------------------------------------------------------------------------*/
+int Encoding::pathLength() {
+    if(_emitter != nullptr) {
+        return _emitter->length();
+    }
+    return static_cast<int>(_variables.size());
+}
 
-    /* solver choice */
-    if(param.solver == Parameters::glucose) {
-      cmd = "./solver/glucose-syrup-4.1/simp/glucose_static";
-    } else { /* minisat anyway */
-      cmd = "./solver/minisat/core/minisat";
+/*----------------------------------------------------------------------------*/
+void Encoding::fixContext(int k, Context& context) {
+    if(_emitter != nullptr) {
+        _emitter->setContext(k, context);
+    } else {
+        setContext(_variables.at(k), context);
+        /* the initial context is propagated through the next global states */
+        if(k == 0) {
+            _possible.assign(_an.nAutomata(), vector<bool>());
+            for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+                _possible.at(autInd).assign(_an.getAutomaton(autInd).nState, context.at(autInd) == -1);
+                if(context.at(autInd) != -1) {
+                    _possible.at(autInd).at(context.at(autInd)) = true;
+                }
+            }
+        }
     }
+}
 
-    // cmd += " -cpu-lim=1";
-    // cmd += " --help";
+/*----------------------------------------------------------------------------*/
+void Encoding::propagateStates() {
+    vector<vector<bool>> possible(_possible);
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        for(auto& trans : _an.getAutomaton(autInd).transitions) {
+            bool playable = _possible.at(autInd).at(trans.origin);
+            for(auto& condPair : trans.conditions) {
+                playable = playable && _possible.at(condPair.first).at(condPair.second);
+            }
+            if(playable) {
+                possible.at(autInd).at(trans.target) = true;
+            }
+        }
+    }
+    _possible.swap(possible);
+}
 
-    if(param.solver != Parameters::ccanr) {
-      if(param.debugLevel < 2) {
-        cmd += " -verb=0";
-      }
+/*----------------------------------------------------------------------------*/
+void Encoding::setConstants(StateVar& stateVar) {
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        vector<bool>& possible = _possible.at(autInd);
+        /* one of the local states is active: the only possible one is true */
+        bool single = (count(possible.begin(), possible.end(), true) == 1);
+        for(int stateInd = 0; stateInd < static_cast<int>(possible.size()); stateInd ++) {
+            if(!possible.at(stateInd) || single) {
+                _ex.setConstant(stateVar.at(autInd).at(stateInd), possible.at(stateInd));
+            }
+        }
     }
+}
+
+/*----------------------------------------------------------------------------*/
+void Encoding::convertTerms() {
 
-    if(param.solver == Parameters::ccanr) {
-      cmd += " -inst";
+    if(_termList.empty()) {
+        return;
     }
 
-    cmd += " temp.dm";
+    /* the cnf variables of the last global state are kept */
+    _ex.setMainTerm(new(_ex) AndOp(_termList));
 
-    if(param.solver != Parameters::ccanr) {
-      cmd += " res";
+    /* the nested and/or are merged before the conversion: they do not need Tseitin variables */
+    /* the reduction renumbers the terms, the cnf variables already known are set again */
+    vector<pair<Variable*, int>> known;
+    for(auto& state : _variables) {
+        for(auto& autVar : state) {
+            for(auto var : autVar) {
+                if(var->index() < static_cast<int>(_cnfVar.size()) && _cnfVar.at(var->index()) != 0) {
+                    known.push_back(pair<Variable*, int>(var, _cnfVar.at(var->index())));
+                }
+            }
+        }
+    }
+    _ex.reduce();
+    _cnfVar.clear();
+    for(auto& elt : known) {
+        _cnfVar.resize(max(_cnfVar.size(), static_cast<size_t>(elt.first->index()+1)), 0);
+        _cnfVar.at(elt.first->index()) = elt.second;
     }
 
-    system(cmd.c_str());
-    // int res = system("./../solver/minisat/simp/minisat_static test/test.dm test/res");
+    _ex.toCnf(_cnfEx, _cnfVar);
+    _termList.clear();
 
-    /* glucose */
-    // int res = system("./../solver/glucose-syrup-4.1/simp/glucose_static test/test.dm test/res");
+    /* cnf variables of the new global states, to read the model and assume the contexts */
+    for(int k = static_cast<int>(_pathCnfVar.size()); k < static_cast<int>(_variables.size()); k ++) {
+        _pathCnfVar.push_back(vector<vector<int>>(_an.nAutomata()));
+        for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+            for(auto var : _variables.at(k).at(autInd)) {
+                _pathCnfVar.at(k).at(autInd).push_back(_cnfVar.at(var->index()));
+            }
+        }
+    }
 
-    bool res = extractSolution(_variables, cnfVar, length);
+    /* the clauses are in the solver: the terms are released, the next transition only needs the variables of the last global state */
+    _ex.clear();
+    _cnfVar.clear();
+    for(auto& step : _noChange) {
+        step.assign(_an.nAutomata(), nullptr);
+    }
+    for(unsigned int k = 0; k+1 < _variables.size(); k ++) {
+        _variables.at(k).clear();
+    }
 
-    if(param.debugLevel > 0) {
-      cout << "sat solving done : " << res << endl;
+    StateVar& last = _variables.back();
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        for(int stateInd = 0; stateInd < static_cast<int>(last.at(autInd).size()); stateInd ++) {
+            Variable* var = new(_ex) Variable(_ex);
+            last.at(autInd).at(stateInd) = var;
+            _cnfVar.resize(var->index()+1, 0);
+            _cnfVar.at(var->index()) = _pathCnfVar.back().at(autInd).at(stateInd);
+        }
+    }
+    if(!_possible.empty()) {
+        setConstants(last);
     }
+}
 
-    system("rm res");
-    system("rm temp.dm");
+/*----------------------------------------------------------------------------*/
+void Encoding::assumeContext(int k, Context& context) {
+    if(_emitter != nullptr) {
+        _emitter->assumeContext(*_solver, k, context);
+        return;
+    }
+    /* the other local states are disabled too, the global state may not be constrained by a context already */
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        if(context.at(autInd) != -1) {
+            for(int stateInd = 0; stateInd < _an.getAutomaton(autInd).nState; stateInd ++) {
+                int var = _pathCnfVar.at(k).at(autInd).at(stateInd);
+                _solver->assume(stateInd == context.at(autInd) ? var : -var);
+            }
+        }
+    }
+}
 
-    return res;
+/*----------------------------------------------------------------------------*/
+bool Encoding::stateValue(int k, int autInd, int stateInd) {
+    if(_emitter != nullptr) {
+        return _emitter->stateValue(*_solver, k, autInd, stateInd);
+    }
+    return _solver->value(_pathCnfVar.at(k).at(autInd).at(stateInd));
 }
 
 /*----------------------------------------------------------------------------*/
-bool Encoding::k_induction(Context& finalCtx, int length) {
+sat::Result Encoding::k_induction(Context& finalCtx, int length) {
 
   Parameters& param = Parameters::getParameters();
 
+  startQuery();
+
+  /* the constraints of the induction are only available on the logical expression */
+  createSolver(false, false);
+
   if(param.debugLevel > 0) {
     cout << "create logical variables" << endl;
   }
@@ -356,20 +617,10 @@ bool Encoding::k_induction(Context& finalCtx, int length) {
   if(param.debugLevel > 0) {
     cout << "disable goal in other states" << endl;
   }
-  
-  unsigned int autGoal = -1;
-  unsigned int stateGoal = -1;
-
-  for(unsigned int i = 0; i < finalCtx.size(); i ++) {
-    if(finalCtx.at(i) != -1) {
-      autGoal = i;
-      stateGoal = finalCtx.at(i);
-    }
-  }
 
-  /* the goal state should be not active for all other states */
+  /* the goal should not be reached in all other states */
   for(int k = 0; k < length-2; k++) {
-    disableState(_variables.at(k), autGoal, stateGoal);
+    disableContext(_variables.at(k), finalCtx);
   }
 
   if(param.debugLevel > 0) {
@@ -394,137 +645,107 @@ bool Encoding::k_induction(Context& finalCtx, int length) {
   if(param.debugLevel > 0) {
     cout << "avoid conflict csontraint" << endl;
   }
-  avoidConflict(_variables.at(0));
+  /* the constraint is added on the cnf variables of the converted path */
+  convertTerms();
+  avoidConflict(0);
 
-  if(param.debugLevel > 0) {
-    cout << "settle main term" << endl;
-  }
+  return solve(length);
 
-  _ex.setMainTerm(new AndOp(_termList));
+}
 
-  vector<cnf::Variable*> cnfVar;
+/*----------------------------------------------------------------------------*/
+sat::Result Encoding::solve(int length) {
 
-  cnf::CnfExpression cnfEx;
+  Parameters& param = Parameters::getParameters();
 
   if(param.debugLevel > 0) {
     cout << "convert to cnf" << endl;
   }
-  _ex.toCnf(cnfEx, cnfVar);
-  cnfEx.exportDimacs("temp.dm");
+  convertTerms();
 
   if(param.debugLevel > 0) {
-    cout << "nVar : " << cnfEx.nVar() << endl;
-    cout << "nClause : " << cnfEx.nClause() << endl;
+    cout << "nVar : " << _cnfEx.nVar() << endl;
+    cout << "nClause : " << _cnfEx.nClause() << endl;
 
     cout << "sat solver lunched" << endl;
   }
 
-  /* command for calling SAT solver */
-  string cmd;
-
-  // if(param.solver == Parameters::glucose) {
-  //   cmd = "./solver/glucose-syrup-4.1/simp/glucose_static";
-  // } else if(param.solver == Parameters::minisat) {
-  //   cmd = "./solver/minisat/core/minisat_static";
-  // } else if(param.solver == Parameters::ccanr) {
-  //   cmd = "./solver/CCAnr_2_cai_source_code/CCAnr";
-  // } else { /* minisat anyway */
-  //   cmd = "./solver/minisat/core/minisat_static";
-  // }
-
-  /* solver choice */
-  if(param.solver == Parameters::glucose) {
-    cmd = "./solver/glucose-syrup-4.1/simp/glucose_static";
-  } else { /* minisat anyway */
-    cmd = "./solver/minisat/core/minisat";
-  }
+  sat::Result answer = callSolver();
 
-  // cmd += " -cpu-lim=1";
-  // cmd += " --help";
+  bool res = extractSolution(answer, length);
 
-  if(param.solver != Parameters::ccanr) {
-    if(param.debugLevel < 2) {
-      cmd += " -verb=0";
-    }
+  if(param.debugLevel > 0) {
+    cout << "sat solving done : " << res << endl;
   }
 
-  if(param.solver == Parameters::ccanr) {
-    cmd += " -inst";
+  return answer;
+}
+
+/*----------------------------------------------------------------------------*/
+void Encoding::startQuery() {
+  Parameters& param = Parameters::getParameters();
+  _limited = (param.timeout > 0);
+  if(_limited) {
+    _deadline = chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(param.timeout));
   }
+}
+
+/*----------------------------------------------------------------------------*/
+bool Encoding::interrupted() {
+  return (_limited && chrono::steady_clock::now() >= _deadline) || (_cancel != nullptr && _cancel->load());
+}
 
-  cmd += " temp.dm";
+/*----------------------------------------------------------------------------*/
+sat::Result Encoding::callSolver() {
 
-  if(param.solver != Parameters::ccanr) {
-    cmd += " res";
+  if(!_limited && _cancel == nullptr) {
+    return _solver->solve();
   }
 
-  system(cmd.c_str());
-  // int res = system("./../solver/minisat/simp/minisat_static test/test.dm test/res");
+  mutex watchMutex;
+  condition_variable answered;
+  bool done = false;
 
-  /* glucose */
-  // int res = system("./../solver/glucose-syrup-4.1/simp/glucose_static test/test.dm test/res");
+  /* the deadline and the cancellation are checked periodically */
+  /* the interruption is repeated until the call returns: a solver clears it when its call starts */
+  thread watchdog([&]() {
+    unique_lock<mutex> lock(watchMutex);
+    while(!done && !interrupted()) {
+      answered.wait_for(lock, chrono::milliseconds(10));
+    }
+    while(!done) {
+      _solver->interrupt();
+      answered.wait_for(lock, chrono::milliseconds(10));
+    }
+  });
 
-  bool res = extractSolution(_variables, cnfVar, length);
+  sat::Result answer = _solver->solve();
 
-  if(param.debugLevel > 0) {
-    cout << "sat solving done : " << res << endl;
+  {
+    lock_guard<mutex> lock(watchMutex);
+    done = true;
   }
+  answered.notify_all();
+  watchdog.join();
 
-  system("rm res");
-  system("rm temp.dm");
-
-  return res;
-
+  return answer;
 }
 
 /*----------------------------------------------------------------------------*/
-bool Encoding::extractSolution(vector<StateVar>& stateVar, vector<cnf::Variable*>& cnfVar, int length) {
+bool Encoding::extractSolution(sat::Result& answer, int length) {
 
   Parameters& param = Parameters::getParameters();
 
-    /* values of the cnf variables */
-    vector<bool> cnfVal(cnfVar.size());
-
-
-    fstream file("res");
-
-    if(!file) {
-      if(param.debugLevel > 0) {
-        cout << "erreur d'ouverture" << endl;
-      }
-      return false;
-    }
-
-    string str;
-    file >> str;
-
-    bool res = true;
-
     if(param.debugLevel > 0) {
-      cout << "str: " << str << endl;
+      cout << "answer: " << (answer == sat::Sat ? "SAT" : (answer == sat::Unsat ? "UNSAT" : "UNKNOWN")) << endl;
     }
 
+    bool res = (answer == sat::Sat);
+
     if(_verbose && param.debugLevel > 1) {
       _extractSolution = true;
     }
 
-    if(str == "UNSAT") {
-        res = false;
-    } else if(str == "SAT" && _extractSolution) {
-        while(!file.eof()) {
-            file >> str;
-            if(str != "0") {
-                bool pol = true;
-                if(str.at(0) == '-') {
-                    pol = false;
-                    str = str.substr(1);
-                }
-                int ind = stoi(str)-1;
-                cnfVal.at(ind) = pol;
-            }
-        }
-    }
-
 
     // create a table to store nb of occurence of objective use
     std::vector<std::vector<std::vector<int>>> nOcc(_an.nAutomata());
@@ -536,9 +757,15 @@ bool Encoding::extractSolution(vector<StateVar>& stateVar, vector<cnf::Variable*
           nOcc.at(ind).resize(_an.getAutomaton(ind).nState, std::vector<int>(_an.getAutomaton(ind).nState,0));
         }
 
-        std::vector<int> context(_an.nAutomata(), -1);
+        vector<Context> trace;
+        if(!this->trace(length, trace)) {
+            /* the query fails alone, the server and the other batch queries go on */
+            cerr << "error, the path cannot be read from the model of the solver" << endl;
+            answer = sat::Unknown;
+            return false;
+        }
 
-        for(int k = 0; k < length; k ++) {
+        for(unsigned int k = 0; k < trace.size(); k ++) {
 
             if(_verbose) {
                 cout << "****************************************************" << endl;
@@ -551,42 +778,17 @@ bool Encoding::extractSolution(vector<StateVar>& stateVar, vector<cnf::Variable*
 
                 auto aut = _an.getAutomaton(autInd);
 
-                bool error = false;
-                int state = -1;
-
-                for(int stateInd = 0; stateInd < _an.getAutomaton(autInd).nState; stateInd ++) {
-
-                    int varInd = stateVar.at(k).at(autInd).at(stateInd)->index();
-                    int cnfInd = cnfVar.at(varInd)->index();
-
-                    if(cnfVal.at(cnfInd)) {
-                        if(state == -1) {
-                            state = stateInd;
-                        } else {
-                            error = true;
-                        }
-                    }
-
-                }
-
-                if(state == -1) {
-                    error = true;
-                    cout << "whaaat" << endl;
-                }
-
-                if(error) {
-                    cout << "critical error" << endl;
-                    exit(0);
-                }
+                int state = trace.at(k).at(autInd);
 
                 bool col = false;
 
-                if(k != 0 && context.at(autInd) != state) {
+                if(k != 0 && trace.at(k-1).at(autInd) != state) {
                     col = true;
 
-                    nOcc.at(autInd).at(context.at(autInd)).at(state) ++;
-                    if(nOcc.at(autInd).at(context.at(autInd)).at(state) > maxOcc) {
-                      maxOcc = nOcc.at(autInd).at(context.at(autInd)).at(state);
+                    int prevState = trace.at(k-1).at(autInd);
+                    nOcc.at(autInd).at(prevState).at(state) ++;
+                    if(nOcc.at(autInd).at(prevState).at(state) > maxOcc) {
+                      maxOcc = nOcc.at(autInd).at(prevState).at(state);
                     }
                 }
 
@@ -600,7 +802,6 @@ bool Encoding::extractSolution(vector<StateVar>& stateVar, vector<cnf::Variable*
                     }
                     cout << ", ";
                 }
-                context.at(autInd) = state;
             }
 
             if(_verbose) {
@@ -617,7 +818,46 @@ bool Encoding::extractSolution(vector<StateVar>& stateVar, vector<cnf::Variable*
 }
 
 /*----------------------------------------------------------------------------*/
-void Encoding::convertContext(StrContext& strCtx, Context& ctx) {
+bool Encoding::trace(int length, vector<Context>& path) {
+
+    path.clear();
+
+    /* local states of each global state of the path */
+    vector<Context> states(length, Context(_an.nAutomata(), -1));
+
+    for(int k = 0; k < length; k ++) {
+        for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+            for(int stateInd = 0; stateInd < _an.getAutomaton(autInd).nState; stateInd ++) {
+                if(stateValue(k, autInd, stateInd)) {
+                    if(states.at(k).at(autInd) != -1) { /* several active local states */
+                        return false;
+                    }
+                    states.at(k).at(autInd) = stateInd;
+                }
+            }
+            if(states.at(k).at(autInd) == -1) {
+                return false;
+            }
+        }
+    }
+
+    /* replay the parallel steps as an interleaved trace, in the automata order, the steps without change are removed */
+    path.push_back(states.at(0));
+    for(int k = 1; k < length; k ++) {
+        Context current = path.back();
+        for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+            if(states.at(k).at(autInd) != current.at(autInd)) {
+                current.at(autInd) = states.at(k).at(autInd);
+                path.push_back(current);
+            }
+        }
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+bool Encoding::convertContext(StrContext& strCtx, Context& ctx) {
 
     ctx.resize(_an.nAutomata(), -1);
 
@@ -628,8 +868,7 @@ void Encoding::convertContext(StrContext& strCtx, Context& ctx) {
             Automaton& aut = _an.getAutomaton(autInd);
 
             if(aut.stateIndex.find(elt.second) == aut.stateIndex.end()) {
-              cout << "fatal error - wrong context for SAT encoding" << endl;
-              exit(0);
+              return false;
             } else {
               ctx.at(autInd) = aut.stateIndex[elt.second];
             }
@@ -637,4 +876,5 @@ void Encoding::convertContext(StrContext& strCtx, Context& ctx) {
         }
     }
 
+    return true;
 }
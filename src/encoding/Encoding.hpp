@@ -8,12 +8,19 @@
 #ifndef ENCODING_HPP
 #define ENCODING_HPP
 
+#include <chrono>
+#include <atomic>
+
 #include "../model/AN.hpp"
 
 #include "../logic/Expression.hpp"
 #include "../logic/Variable.hpp"
 #include "../logic/Operation.hpp"
 
+#include "../sat/Solver.hpp"
+
+#include "CnfEmitter.hpp"
+
 typedef std::vector<std::vector<Variable*>> StateVar;
 
 /*!
@@ -30,22 +37,56 @@ class Encoding {
          */
         Encoding(AN& an);
 
+        /*!
+         * \brief destructor, free the solver
+         */
+        ~Encoding();
+
         /*!
          * \brief encode the reachability problem
          * \param initCtx the initial context
          * \param finalCtx the final context
          * \param length the length of the path encoded
-         * \return true if the final context is reachable from the initial context
+         * \return Sat if the final context is reachable from the initial context, Unknown if the solver has not answered (budget exhausted or failure)
          */
-        bool reachability(Context& initCtx, Context& finalCtx, int length);
+        sat::Result reachability(Context& initCtx, Context& finalCtx, int length);
+
+        /*!
+         * \brief look for the shortest path by unrolling one more step at a time, on the same solver
+         * \param initCtx the initial context
+         * \param finalCtx the final context
+         * \param maxLength maximal length of the path, no limit if <= 0
+         * \param length the length of the path found, or of the last path tried
+         * \return Sat if a path is found, Unsat if there is no path up to the maximal length, Unknown if the solver has not answered
+         */
+        sat::Result deepening(Context& initCtx, Context& finalCtx, int maxLength, int& length);
+
+        /*!
+         * \brief answer a reachability query on the path kept between the queries, the contexts are assumed
+         * \param initCtx the initial context
+         * \param finalCtx the final context
+         * \param length the length of the path
+         * \return the answer of the solver
+         */
+        sat::Result query(Context& initCtx, Context& finalCtx, int length);
+
+        /*!
+         * \brief look for the shortest path on the path kept between the queries, the final context is assumed on one more global state at a time
+         * \param initCtx the initial context
+         * \param finalCtx the final context
+         * \param maxLength maximal length of the path, no limit if <= 0
+         * \param length the length of the path found, or of the last path tried
+         * \return Sat if a path is found, Unsat if there is no path up to the maximal length, Unknown if the solver has not answered
+         */
+        sat::Result queryDeepening(Context& initCtx, Context& finalCtx, int maxLength, int& length);
 
         /*!
          * \brief apply the k-induction techniques to look for a bound
          * \param finalCtx the final context
          * \param length the length of the unconstrained path encoded
-         * \return true if the final context is reachable from the initial context
+         * \return Sat if the final context is reachable from the unconstrained path, Unknown if the solver has not answered
          */
-        bool k_induction(Context& finalCtx, int length);
+        sat::Result k_induction(Context& finalCtx, int length);
 
         /*!
          * \brief change the verbose variable
@@ -59,6 +100,28 @@ class Encoding {
          */
         void setExtractSolution(bool extract);
 
+        /*!
+         * \brief set a flag that cancels the queries: the path creation stops and the solver calls are interrupted once it is raised
+         * \param cancel the flag, nullptr if the queries cannot be cancelled
+         */
+        void setCancel(const std::atomic<bool>* cancel);
+
+        /*!
+         * \brief extract the solution returned by the SAT solver
+         * \param answer the answer of the solver, set to Unknown if the path cannot be read from the model
+         * \param length length of the path
+         * \return true of the SAT instance was satisfiable
+         */
+        bool extractSolution(sat::Result& answer, int length);
+
+        /*!
+         * \brief decode the path of the last satisfiable call from the values of the solver, the parallel steps are replayed as interleaved steps and the steps without change are removed
+         * \param length length of the path
+         * \param path the global states of the path, modified
+         * \return false if an automaton has no active local state or several ones in a global state
+         */
+        bool trace(int length, std::vector<Context>& path);
+
     private: /* private methods */
 
         /*!
@@ -89,10 +152,17 @@ class Encoding {
         void disableState(StateVar& stateVar, int autInd, int stateInd);
 
         /*!
-         * \brief avoid conflict between the local states
-         * \param stateVar variables of the local state
+         * \brief force a context to be not verified in a global state
+         * \param stateVar the variables of the global state
+         * \param context the context
+         */
+        void disableContext(StateVar& stateVar, Context& context);
+
+        /*!
+         * \brief avoid conflict between the local states, at most one local state of each automaton is active
+         * \param k index of the global state, already converted to cnf
          */
-        void avoidConflict(StateVar& stateVar);
+        void avoidConflict(int k);
 
         /*!
          * \brief create a transition between two global states
@@ -126,13 +196,95 @@ class Encoding {
          void allDiff(std::vector<StateVar>& variables);
 
         /*!
-         * \brief extract the solution returned by the SAT solver
-         * \param stateVar list of the state variables of the path
-         * \param cnfVar list of the cnf Variables
+         * \brief create the solver and the clause generator
+         * \param direct true if the clauses are generated directly, without logical expression
+         * \param incremental true if clauses are added after the first solver call, the formula is not preprocessed
+         */
+        void createSolver(bool direct, bool incremental);
+
+        /*!
+         * \brief add a global state at the end of the path, with the transition from the previous one
+         */
+        void addGlobalState();
+
+        /*!
+         * \brief number of global states in the path
+         * \return the number of global states
+         */
+        int pathLength();
+
+        /*!
+         * \brief add a context constraint for a global state of the path
+         * \param k index of the global state
+         * \param context the context
+         */
+        void fixContext(int k, Context& context);
+
+        /*!
+         * \brief compute the local states that may be active in a new global state from the previous one, one transition at a time (over-approximation)
+         */
+        void propagateStates();
+
+        /*!
+         * \brief fix the variables of the local states that can not be active to false, and the only possible local state of an automaton to true
+         * \param stateVar the variables of the last global state
+         */
+        void setConstants(StateVar& stateVar);
+
+        /*!
+         * \brief assume a context on a global state for the next solver call
+         * \param k index of the global state
+         * \param context the context
+         */
+        void assumeContext(int k, Context& context);
+
+        /*!
+         * \brief value of a local state in the model found by the solver
+         * \param k index of the global state
+         * \param autInd the automaton index
+         * \param stateInd the state index
+         * \return true iff the local state is active
+         */
+        bool stateValue(int k, int autInd, int stateInd);
+
+        /*!
+         * \brief convert the constraints created since the last conversion to cnf, then release their terms:
+         * only the variables of the last global state are kept for the next transition
+         */
+        void convertTerms();
+
+        /*!
+         * \brief convert the expression to cnf and solve it
          * \param length length of the path
-         * \return true of the SAT instance was satisfiable
+         * \return the answer of the solver
+         */
+        sat::Result solve(int length);
+
+        /*!
+         * \brief start the budget of a query: the solver calls are interrupted once its time limit is reached
+         */
+        void startQuery();
+
+        /*!
+         * \brief call the solver within the budget of the query, on the current assumptions
+         * \return the answer of the solver, Unknown if it has been interrupted
+         */
+        sat::Result callSolver();
+
+        /*!
+         * \brief solve a query on the path kept between the queries, the path is unrolled up to its length if needed
+         * \param initCtx the initial context, assumed on the first global state
+         * \param finalCtx the final context, assumed on the last global state
+         * \param length the length of the path
+         * \return the answer of the solver
          */
-        bool extractSolution(std::vector<StateVar>& stateVar, std::vector<cnf::Variable*>& cnfVar, int length);
+        sat::Result solveAssumed(Context& initCtx, Context& finalCtx, int length);
+
+        /*!
+         * \brief check if the current query has to stop
+         * \return true if its time limit is reached or if it has been cancelled
+         */
+        bool interrupted();
 
         /*!
          * \brief get a noChange node
@@ -146,8 +298,9 @@ class Encoding {
          * \brief convert a string context to a context
          * \param strCtx the string context
          * \param ctx the context
+         * \return false if a local state is unknown
          */
-        void convertContext(StrContext& strCtx, Context& ctx);
+        bool convertContext(StrContext& strCtx, Context& ctx);
 
     private:
 
@@ -161,10 +314,27 @@ class Encoding {
 
         std::vector<std::vector<AndOp*>> _noChange; /* no change loc state node */
 
+        cnf::CnfExpression _cnfEx; /* clauses given to the solver */
+
+        std::vector<int> _cnfVar; /* cnf variable of each term of the logical expression, 0 if none */
+
+        std::vector<std::vector<std::vector<int>>> _pathCnfVar; /* cnf variable of each local state of the path, kept after the terms are released */
+
+        std::vector<std::vector<bool>> _possible; /* local states that may be active in the last global state, empty if the initial context is not fixed */
+
+        sat::Solver* _solver; /* SAT solver */
+
+        CnfEmitter* _emitter; /* direct clause generation, nullptr if the logical expression is used */
+
         bool _verbose; /* display the final path */
 
         bool _extractSolution; /* extract the solution */
 
+        bool _limited; /* the current query has a time limit */
+        std::chrono::steady_clock::time_point _deadline; /* end of the time limit of the current query */
+
+        const std::atomic<bool>* _cancel; /* cancellation flag of the queries, nullptr if none */
+
 };
 
 #endif
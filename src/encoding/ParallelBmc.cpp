@@ -0,0 +1,182 @@
+/*!
+ * \file ParallelBmc.cpp
+ * \brief implementation of the ParallelBmc class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include <iostream>
+#include <thread>
+#include <chrono>
+
+#include "ParallelBmc.hpp"
+
+#include "../interface/Parameters.hpp"
+
+using namespace std;
+
+/* status of the lengths */
+const int notStarted = 0;
+const int running = 1;
+const int done = 2;
+
+/*----------------------------------------------------------------------------*/
+ParallelBmc::ParallelBmc(AN& an, Context& initCtx, Context& finalCtx):
+_an(an),
+_initCtx(initCtx),
+_finalCtx(finalCtx),
+_minLength(1),
+_maxLength(0),
+_unsat(0),
+_sat(1),
+_shortest(nullptr),
+_stopped(false),
+_nWorking(0)
+{
+
+}
+
+/*----------------------------------------------------------------------------*/
+ParallelBmc::~ParallelBmc() {
+  delete _shortest;
+}
+
+/*----------------------------------------------------------------------------*/
+sat::Result ParallelBmc::solve(int minLength, int maxLength, int nThreads, int& length) {
+
+  Parameters& param = Parameters::getParameters();
+
+  _minLength = max(minLength, 1);
+  _maxLength = max(maxLength, _minLength);
+  _unsat = _minLength-1;
+  _sat = _maxLength+1;
+  _status.assign(_maxLength+1, notStarted);
+  _cancel = vector<atomic<bool>>(_maxLength+1);
+  for(auto& flag : _cancel) {
+    flag = false;
+  }
+  _stopped = false;
+
+  if(nThreads <= 0) {
+    nThreads = static_cast<int>(thread::hardware_concurrency());
+  }
+  if(nThreads <= 0) {
+    nThreads = 1;
+  }
+
+  _nWorking = nThreads;
+  vector<thread> workers;
+  for(int ind = 0; ind < nThreads; ind ++) {
+    workers.push_back(thread(&ParallelBmc::work, this));
+  }
+
+  /* the time limit is shared by all the lengths: the running ones are cancelled once it is reached */
+  if(param.timeout > 0) {
+    auto deadline = chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(param.timeout));
+    unique_lock<mutex> lock(_mutex);
+    if(!_finished.wait_until(lock, deadline, [this]() { return _nWorking == 0; })) {
+      _stopped = true;
+      for(auto& flag : _cancel) {
+        flag = true;
+      }
+    }
+  }
+
+  for(auto& worker : workers) {
+    worker.join();
+  }
+
+  if(_sat <= _maxLength) {
+    length = _sat;
+    return sat::Sat;
+  }
+
+  length = _maxLength;
+  return _unsat >= _maxLength ? sat::Unsat : sat::Unknown;
+}
+
+/*----------------------------------------------------------------------------*/
+Encoding* ParallelBmc::shortest() {
+  return _shortest;
+}
+
+/*----------------------------------------------------------------------------*/
+void ParallelBmc::work() {
+
+  Parameters& param = Parameters::getParameters();
+
+  unique_lock<mutex> lock(_mutex);
+
+  while(true) {
+
+    int length = nextLength();
+    if(length < 0) {
+      break;
+    }
+    _status.at(length) = running;
+
+    lock.unlock();
+
+    if(param.debugLevel > 0) {
+      cout << "path length " << length << " started" << endl;
+    }
+
+    Encoding* en = new Encoding(_an);
+    en->setCancel(&_cancel.at(length));
+    sat::Result res = en->reachability(_initCtx, _finalCtx, length);
+
+    lock.lock();
+
+    _status.at(length) = done;
+
+    if(res == sat::Sat && length < _sat) {
+      /* the greater lengths also have a path */
+      _sat = length;
+      for(int len = length+1; len <= _maxLength; len ++) {
+        _cancel.at(len) = true;
+      }
+      delete _shortest;
+      _shortest = en;
+      en = nullptr;
+    } else if(res == sat::Unsat && length > _unsat) {
+      /* the smaller lengths have no path either */
+      _unsat = length;
+      for(int len = _minLength; len < length; len ++) {
+        _cancel.at(len) = true;
+      }
+    }
+
+    delete en;
+  }
+
+  _nWorking --;
+  lock.unlock();
+  _finished.notify_all();
+}
+
+/*----------------------------------------------------------------------------*/
+int ParallelBmc::nextLength() {
+
+  if(_stopped) {
+    return -1;
+  }
+
+  if(_status.at(_maxLength) == notStarted) {
+    return _maxLength;
+  }
+
+  /* middle of the largest interval of lengths not started between the undecided lengths, the shortest path is searched once a path is found */
+  int res = -1, size = 0;
+  int prev = _unsat;
+  for(int len = _unsat+1; len <= min(_sat, _maxLength+1); len ++) {
+    if(len > _maxLength || _status.at(len) != notStarted) {
+      if(len-prev-1 > size) {
+        size = len-prev-1;
+        res = (prev+len)/2;
+      }
+      prev = len;
+    }
+  }
+
+  return res;
+}
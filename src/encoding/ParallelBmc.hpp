@@ -0,0 +1,100 @@
+/*!
+ * \file ParallelBmc.hpp
+ * \brief class ParallelBmc to solve several lengths of the path concurrently
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef PARALLEL_BMC_HPP
+#define PARALLEL_BMC_HPP
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+#include "../model/AN.hpp"
+
+#include "Encoding.hpp"
+
+/*!
+ * \class ParallelBmc
+ * \brief solve the reachability problem for several lengths of the path at the same time, one encoding and one solver per length
+ *
+ * A path can stay in a global state, so a path of length k exists for all the lengths greater than k: the answer of a length decides all the greater lengths (path) or all the smaller ones (no path).
+ * The lengths of the range are chosen in the largest interval that is still undecided, the maximal length first since it decides the unreachability.
+ * Once a path is found, the greater lengths are cancelled and the smaller ones are still bisected until the shortest path is found.
+ */
+class ParallelBmc {
+
+  public:
+
+    /*!
+     * \brief constructor
+     * \param an the automata network, shared and only read by the threads
+     * \param initCtx the initial context
+     * \param finalCtx the final context
+     */
+    ParallelBmc(AN& an, Context& initCtx, Context& finalCtx);
+
+    /*!
+     * \brief destructor
+     */
+    ~ParallelBmc();
+
+    /*!
+     * \brief solve the lengths of a range in parallel
+     * \param minLength smallest length of the path
+     * \param maxLength greatest length of the path
+     * \param nThreads number of lengths solved at the same time, number of cores if <= 0
+     * \param length shortest length with a path if the answer is Sat (shortest found if the time limit is reached)
+     * \return Sat if a path has been found, Unsat if there is no path of length maxLength, Unknown otherwise
+     */
+    sat::Result solve(int minLength, int maxLength, int nThreads, int& length);
+
+    /*!
+     * \brief get the encoding of the shortest path found
+     * \return the encoding, nullptr if no path has been found
+     */
+    Encoding* shortest();
+
+  private:
+
+    /*!
+     * \brief solve lengths until none is useful anymore
+     */
+    void work();
+
+    /*!
+     * \brief choose the next length to solve, the mutex is locked
+     * \return the length, -1 if there is none
+     */
+    int nextLength();
+
+  private:
+
+    AN& _an; /* automata network */
+
+    Context& _initCtx; /* initial context */
+    Context& _finalCtx; /* final context */
+
+    int _minLength; /* smallest length of the range */
+    int _maxLength; /* greatest length of the range */
+
+    int _unsat; /* greatest length without path, _minLength-1 if none */
+    int _sat; /* smallest length with a path, _maxLength+1 if none */
+
+    std::vector<int> _status; /* status of each length: 0 not started, 1 running, 2 done */
+    std::vector<std::atomic<bool>> _cancel; /* cancellation flag of each length */
+
+    Encoding* _shortest; /* encoding of the shortest path found */
+
+    bool _stopped; /* no new length is started: the time limit is reached */
+    int _nWorking; /* number of threads still working */
+
+    std::mutex _mutex; /* protection of the state of the search */
+    std::condition_variable _finished; /* signaled when a thread stops */
+
+};
+
+#endif
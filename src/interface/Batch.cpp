@@ -0,0 +1,114 @@
+/*!
+ * \file Batch.cpp
+ * \brief implementation of the Batch class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <mutex>
+
+#include "Batch.hpp"
+#include "Parameters.hpp"
+#include "Query.hpp"
+
+using namespace std;
+
+/* protect the query counters and the output */
+static mutex batchMutex;
+
+/*----------------------------------------------------------------------------*/
+Batch::Batch(string model):
+_model(model),
+_next(0),
+_written(0)
+{
+
+}
+
+/*----------------------------------------------------------------------------*/
+void Batch::run(string fileName, int nThreads) {
+
+  ifstream file(fileName);
+
+  if(!file) {
+    cout << "error, the query file " << fileName << " cannot be opened" << endl;
+    return;
+  }
+
+  /* the queries are read before solving, the model is not modified by the threads */
+  string line;
+  while(getline(file, line)) {
+    if(line.find_first_not_of(" \t\r") == string::npos) {
+      continue;
+    }
+    Context initCtx, finalCtx;
+    int bound;
+    _answer.push_back(Query::parse(_model, line, initCtx, finalCtx, bound));
+    _initCtx.push_back(initCtx);
+    _finalCtx.push_back(finalCtx);
+    _bound.push_back(bound);
+  }
+  _done.resize(_answer.size(), false);
+
+  if(nThreads <= 0) {
+    nThreads = static_cast<int>(thread::hardware_concurrency());
+  }
+  if(nThreads <= 0) {
+    nThreads = 1;
+  }
+
+  vector<thread> workers;
+  for(int ind = 0; ind < nThreads; ind ++) {
+    workers.push_back(thread(&Batch::work, this));
+  }
+  for(auto& worker : workers) {
+    worker.join();
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+void Batch::work() {
+
+  /* the solutions of the objectives are shared by the queries of the thread, the cache is not protected */
+  LCG::SolutionCache solutions;
+
+  while(true) {
+
+    unsigned int ind;
+    {
+      lock_guard<mutex> lock(batchMutex);
+      if(_next >= _answer.size()) {
+        break;
+      }
+      ind = _next ++;
+    }
+
+    string res = _answer.at(ind);
+    if(res.empty()) {
+      res = answer(_initCtx.at(ind), _finalCtx.at(ind), _bound.at(ind), solutions);
+    }
+
+    /* the answers are written in the order of the queries */
+    lock_guard<mutex> lock(batchMutex);
+    _answer.at(ind) = res;
+    _done.at(ind) = true;
+    while(_written < _done.size() && _done.at(_written)) {
+      cout << _answer.at(_written) << endl;
+      _written ++;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+string Batch::answer(Context& initCtx, Context& finalCtx, int bound, LCG::SolutionCache& solutions) {
+
+  Query current(_model, initCtx, finalCtx, bound, Parameters::getParameters().reduce, &solutions);
+  if(current.status() == Query::ready) {
+    current.solve();
+  }
+
+  return current.answerLine();
+}
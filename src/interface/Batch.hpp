@@ -0,0 +1,72 @@
+/*!
+ * \file Batch.hpp
+ * \brief class Batch to answer a file of reachability queries in parallel
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <string>
+#include <vector>
+
+#include "../model/AN.hpp"
+#include "../lcg/Graph.hpp"
+
+/*!
+ * \class Batch
+ * \brief answer the queries of a file on a pool of threads, the model is shared and only read
+ *
+ * The queries have the same format as the server queries, one answer line is written for each of them, in the order of the file.
+ */
+class Batch {
+
+  public:
+
+    /*!
+     * \brief constructor
+     * \param model path of the automata network file
+     */
+    Batch(std::string model);
+
+    /*!
+     * \brief answer all the queries of a file
+     * \param fileName path of the query file
+     * \param nThreads number of threads, number of cores if <= 0
+     */
+    void run(std::string fileName, int nThreads);
+
+  private:
+
+    /*!
+     * \brief answer the queries until there is no query left, executed by each thread
+     */
+    void work();
+
+    /*!
+     * \brief answer a query with its own LCG and encoding
+     * \param initCtx the initial context
+     * \param finalCtx the final context
+     * \param bound the bound of the query, -1 if not specified
+     * \param solutions solutions of the objectives computed by the previous queries of the thread
+     * \return the answer line
+     */
+    std::string answer(Context& initCtx, Context& finalCtx, int bound, LCG::SolutionCache& solutions);
+
+  private:
+
+    AN _model; /* automata network of the queries */
+
+    std::vector<Context> _initCtx; /* initial contexts of the queries */
+    std::vector<Context> _finalCtx; /* final contexts of the queries */
+    std::vector<int> _bound; /* bounds of the queries */
+    std::vector<std::string> _answer; /* answer lines, the errors are known before solving */
+
+    std::vector<bool> _done; /* queries answered */
+    unsigned int _next; /* next query to answer */
+    unsigned int _written; /* number of answers written */
+
+};
+
+#endif
@@ -12,7 +12,10 @@
 #include "../model/AN.hpp"
 #include "../encoding/Encoding.hpp"
 #include "../asp/ASP.hpp"
-#include "../lcg/Graph.hpp"
+#include "Server.hpp"
+#include "Batch.hpp"
+#include "Query.hpp"
+#include "../sat/Solver.hpp"
 
 using namespace std;
 
@@ -34,6 +37,18 @@ void Framework::exec() {
 
   if(param.help) { /* show the help */
     param.showHelp();
+  } else if(param.steps != Parameters::interleaving && (param.tree || param.k_induction)) {
+    /* the parallel steps are only encoded by the direct clause generation */
+    cout << "error, -steps forall and exists cannot be used with -tree and -k_induction" << endl;
+  } else if(param.memory > 0 && linkedSolver()) {
+    /* the memory limit is set on the external solver programs only */
+    cout << "error, -memory cannot be used with a SAT solver linked in aan_reach (minisat, glucose)" << endl;
+  } else if(!param.batch.empty()) { /* answer a file of queries in parallel */
+    Batch batch(param.model);
+    batch.run(param.batch, param.nThreads);
+  } else if(param.server) { /* answer the queries on the same model */
+    Server server(param.model);
+    server.run();
   } else { /* lunch the reachability solver */
     if(param.k_induction) {
       k_induction();
@@ -44,6 +59,21 @@ void Framework::exec() {
 
 }
 
+/*----------------------------------------------------------------------------*/
+bool Framework::linkedSolver() {
+
+  Parameters& param = Parameters::getParameters();
+
+  bool res = param.portfolio.empty() && sat::Solver::linked(param.solver);
+  for(auto kind : param.portfolio) {
+    if(sat::Solver::linked(kind)) {
+      res = true;
+    }
+  }
+
+  return res;
+}
+
 /*----------------------------------------------------------------------------*/
 void Framework::reachability() {
 
@@ -58,24 +88,24 @@ void Framework::reachability() {
     AN model(param.model);
 
     /* extract goal */
-    if(param.goal.size() != 1) {
-      cout << "error, this feature is not implemented" << endl;
+    if(param.goal.empty()) {
+      cout << "error, no goal specified" << endl;
       exit(0);
     }
 
-    /* identification of the goal state */
-    LocalState goal;
-    {
-      auto it = param.goal.begin();
-      int autInd = model.getAutomatonIndex(it->first);
+    /* identification of the goal states, all of them have to be reached at the same time */
+    vector<LocalState> goals;
+    for(auto& elt : param.goal) {
+      int autInd = model.getAutomatonIndex(elt.first);
       auto automaton = model.getAutomaton(autInd);
-      goal.automaton = autInd;
-      goal.state = automaton.stateIndex[it->second];
+      goals.push_back(LocalState(autInd, automaton.stateIndex[elt.second]));
     }
 
     /* creation of the final context */
     Context finalCtx(model.nAutomata(),-1);
-    finalCtx.at(goal.automaton) = goal.state;
+    for(auto& goal : goals) {
+      finalCtx.at(goal.automaton) = goal.state;
+    }
 
     /* Creation of the initial context */
     Context initCtx = model.initialContext();
@@ -85,55 +115,50 @@ void Framework::reachability() {
       initCtx.at(autInd) = aut.stateIndex[elt.second];
     }
 
-    /* Local Causality Graph (for the bound) */
-    LCG::Graph lcg(model, initCtx, goal);
-
-    if(param.bound <= 0) { /* create the LCG */
-      lcg.build();
-    }
-
-    bool reachable = false;
-
-    bool lcg_cycles;
-    if(param.bound <= 0) {
-      lcg_cycles = lcg.checkCycle();
-    }
+    /* bound from the Local Causality Graph, network encoded */
+    Query query(model, initCtx, finalCtx, param.bound, param.reduce);
 
-    if(param.bound <= 0 && lcg_cycles) {
+    if(query.status() == Query::boundNeeded) {
 
       cout << "The Local Causality Graph contains cycles, the bound cannot be computed." << endl;
 
-    } else {
+    } else if(query.status() == Query::timeoutNeeded) {
 
-      unsigned int bound = -1;
+      cout << "The Local Causality Graph contains cycles, -deepen needs a bound (-b) or a time limit (-timeout)." << endl;
 
-      if(param.bound <= 0 && !lcg_cycles) {
-        bound = lcg.computeBound();
-        cout << "Local causality bound: " << bound << " state(s)" << endl;
+    } else {
 
-      } else {
+      if(param.bound <= 0 && !query.cycles()) {
+        cout << "Local causality bound: " << query.lcgBound() << " state(s)" << endl;
+      } else if(param.bound > 0) {
         cout << "Bound manually set to " << param.bound << endl;
+      } else {
+        cout << "The Local Causality Graph contains cycles, the length of the path is increased until the goal is reached." << endl;
       }
 
+      query.setVerbose(param.debugLevel >= 1);
+      sat::Result answer = query.solve();
 
-      // if(param.encoding == Parameters::SAT) {
-      Encoding en(model);
-      if(param.debugLevel >= 1) {
-        en.setVerbose(true);
+      if(answer == sat::Sat && param.deepening) {
+        cout << "Shortest path: " << query.length() << " state(s)" << endl;
+      } else if(answer == sat::Sat && param.parallel) {
+        cout << "Shortest path found: " << query.length() << " state(s)" << endl;
       }
-      if(param.bound <= 0) {
-        reachable = en.reachability(initCtx, finalCtx, bound);
-      } else {
-        reachable = en.reachability(initCtx, finalCtx, param.bound);
+
+      vector<Context> path;
+      if(param.trace && query.trace(path)) {
+        /* the witness is given on the automata network of the model */
+        cout << endl << "Trace:" << endl;
+        for(auto& ctx : path) {
+          cout << model.contextToString(ctx) << endl;
+        }
       }
-      // } else if(param.encoding == Parameters::ASP) {
-      //   ASP aspEnc(model);
-      //   reachable = aspEnc.reachability(initCtx, finalCtx, bound+1);
-      // }
 
       cout << endl << "Result: ";
-      if(reachable) {
+      if(answer == sat::Sat) {
         cout << "reachable" << endl;
+      } else if(answer == sat::Unknown) {
+        cout << "unknown (budget exhausted or solver failure)" << endl;
       } else {
         if(param.bound <= 0) {
           cout << "unreachable" << endl;
@@ -162,27 +187,25 @@ void Framework::k_induction() {
     AN model(param.model);
 
     /* extract goal */
-    if(param.goal.size() != 1) {
-      cout << "error, no time to implement this feature" << endl;
+    if(param.goal.empty()) {
+      cout << "error, no goal specified" << endl;
       exit(0);
     }
 
-    /* identification of the goal state */
-    LocalState goal;
-    {
-      auto it = param.goal.begin();
-      int autInd = model.getAutomatonIndex(it->first);
+    /* identification of the goal states, all of them have to be reached at the same time */
+    vector<LocalState> goals;
+    for(auto& elt : param.goal) {
+      int autInd = model.getAutomatonIndex(elt.first);
       auto automaton = model.getAutomaton(autInd);
-      goal.automaton = autInd;
-      goal.state = automaton.stateIndex[it->second];
+      goals.push_back(LocalState(autInd, automaton.stateIndex[elt.second]));
     }
 
     /* creation of the final context */
     Context finalCtx(model.nAutomata(),-1);
-    finalCtx.at(goal.automaton) = goal.state;
-
+    for(auto& goal : goals) {
+      finalCtx.at(goal.automaton) = goal.state;
+    }
 
-    bool satisfiable = false;
 
     // if(param.encoding == Parameters::SAT) {
     Encoding en(model);
@@ -193,10 +216,12 @@ void Framework::k_induction() {
     cout << "bound: " << param.bound << endl;
 
     if(param.bound >= 2) {
-      satisfiable = en.k_induction(finalCtx, param.bound);
+      sat::Result answer = en.k_induction(finalCtx, param.bound);
       cout << endl << "Result: the length ";
-      if(satisfiable) {
+      if(answer == sat::Sat) {
         cout << param.bound << " may not be a completeness bound for that instance" << endl;
+      } else if(answer == sat::Unknown) {
+        cout << param.bound << " could not be checked (budget exhausted or solver failure)" << endl;
       } else {
         cout << param.bound << " is a completeness bound for that instance" << endl;
       }
@@ -54,6 +54,12 @@ class Framework {
      */
     void k_induction();
 
+    /*!
+     * \brief tell if one of the SAT solvers chosen is linked in the program
+     * \return true iff a linked solver is used
+     */
+    bool linkedSolver();
+
 };
 
 #endif
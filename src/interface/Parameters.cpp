@@ -7,6 +7,7 @@
 
 #include <iostream>
 #include <regex>
+#include <algorithm>
 
 #include "Parameters.hpp"
 
@@ -19,7 +20,24 @@ Parameters::Parameters() {
   debugLevel = 0;
   help = false;
   bound = -1;
+  minBound = 0;
+  parallel = false;
   k_induction = false;
+  deepening = false;
+  trace = false;
+  tree = false;
+  stateEncoding = automatic;
+  transitionEncoding = rule;
+  steps = interleaving;
+  reduce = true;
+  server = false;
+  nThreads = 0;
+  preprocess = false;
+  pipe = false;
+  atMostOne = cnf::Cardinality::Automatic;
+  timeout = 0;
+  conflicts = 0;
+  memory = 0;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -51,23 +69,115 @@ void Parameters::loadFromCmd(int argc, char** argv) {
     } else if(token == "-d") {
       debugLevel = stoi(argv[i+1]);
     } else if(token == "-s") {
-      if(string(argv[i+1]) == "minisat") {
-        solver = minisat;
-      } else if(string(argv[i+1]) == "glucose") {
-        solver = glucose;
-      } else if(string(argv[i+1]) == "maplecomsps") {
-        solver = maplecomsps;
-      } else if(string(argv[i+1]) == "ccanr") {
-        solver = ccanr;
+      solverFromName(argv[i+1], solver);
+    } else if(token == "-portfolio") {
+      /* list of solvers separated by commas */
+      portfolio.clear();
+      string list = argv[i+1];
+      size_t begin = 0;
+      while(begin <= list.size()) {
+        size_t end = list.find(',', begin);
+        if(end == string::npos) {
+          end = list.size();
+        }
+        Solver kind;
+        if(solverFromName(list.substr(begin, end-begin), kind)) {
+          portfolio.push_back(kind);
+        }
+        begin = end+1;
       }
     } else if(token == "-h") {
       help = true;
       i --;
     } else if(token == "-b") {
-      bound = stoi(argv[i+1]);
+      /* a bound or a range of bounds "min:max" */
+      string range = argv[i+1];
+      size_t sep = range.find(':');
+      if(sep == string::npos) {
+        bound = stoi(range);
+      } else {
+        minBound = stoi(range.substr(0, sep));
+        bound = stoi(range.substr(sep+1));
+        parallel = true;
+      }
+    } else if(token == "-parallel") {
+      parallel = true;
+      i --;
     } else if(token == "-k_induction") {
       k_induction = true;
       i --;
+    } else if(token == "-deepen") {
+      deepening = true;
+      i --;
+    } else if(token == "-trace") {
+      trace = true;
+      i --;
+    } else if(token == "-server") {
+      server = true;
+      i --;
+    } else if(token == "-socket") {
+      server = true;
+      socket = string(argv[i+1]);
+    } else if(token == "-batch") {
+      batch = string(argv[i+1]);
+    } else if(token == "-j") {
+      nThreads = stoi(argv[i+1]);
+    } else if(token == "-timeout") {
+      timeout = stod(argv[i+1]);
+    } else if(token == "-conflicts") {
+      conflicts = stoi(argv[i+1]);
+    } else if(token == "-memory") {
+      memory = stoi(argv[i+1]);
+    } else if(token == "-no_reduce") {
+      reduce = false;
+      i --;
+    } else if(token == "-preprocess") {
+      preprocess = true;
+      i --;
+    } else if(token == "-pipe") {
+      pipe = true;
+      i --;
+    } else if(token == "-tree") {
+      tree = true;
+      i --;
+    } else if(token == "-state_encoding") {
+      if(string(argv[i+1]) == "onehot") {
+        stateEncoding = onehot;
+      } else if(string(argv[i+1]) == "log") {
+        stateEncoding = logarithmic;
+      } else if(string(argv[i+1]) == "order") {
+        stateEncoding = order;
+      } else if(string(argv[i+1]) == "auto") {
+        stateEncoding = automatic;
+      }
+    } else if(token == "-transitions") {
+      if(string(argv[i+1]) == "rule") {
+        transitionEncoding = rule;
+      } else if(string(argv[i+1]) == "selector") {
+        transitionEncoding = selector;
+      }
+    } else if(token == "-amo") {
+      if(string(argv[i+1]) == "pairwise") {
+        atMostOne = cnf::Cardinality::Pairwise;
+      } else if(string(argv[i+1]) == "sequential") {
+        atMostOne = cnf::Cardinality::Sequential;
+      } else if(string(argv[i+1]) == "commander") {
+        atMostOne = cnf::Cardinality::Commander;
+      } else if(string(argv[i+1]) == "bimander") {
+        atMostOne = cnf::Cardinality::Bimander;
+      } else if(string(argv[i+1]) == "product") {
+        atMostOne = cnf::Cardinality::Product;
+      } else if(string(argv[i+1]) == "auto") {
+        atMostOne = cnf::Cardinality::Automatic;
+      }
+    } else if(token == "-steps") {
+      if(string(argv[i+1]) == "interleaving") {
+        steps = interleaving;
+      } else if(string(argv[i+1]) == "forall") {
+        steps = forall;
+      } else if(string(argv[i+1]) == "exists") {
+        steps = exists;
+      }
     } else {
       i --;
     }
@@ -78,6 +188,22 @@ void Parameters::loadFromCmd(int argc, char** argv) {
 
 }
 
+/*----------------------------------------------------------------------------*/
+bool Parameters::solverFromName(string name, Solver& kind) {
+  if(name == "minisat") {
+    kind = minisat;
+  } else if(name == "glucose") {
+    kind = glucose;
+  } else if(name == "maplecomsps") {
+    kind = maplecomsps;
+  } else if(name == "ccanr") {
+    kind = ccanr;
+  } else {
+    return false;
+  }
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 void Parameters::extractContext(string token, StrContext& ctx) {
 
@@ -129,6 +255,13 @@ void Parameters::display() {
     } else {
       cout << "error" << endl;
     }
+    if(!portfolio.empty()) {
+      cout << "Portfolio:\t- ";
+      for(auto kind : portfolio) {
+        cout << (kind == minisat ? "minisat" : (kind == glucose ? "glucose" : (kind == maplecomsps ? "maplecomsps" : "ccanr"))) << " ";
+      }
+      cout << endl;
+    }
   }
 
   cout << "Model:";
@@ -154,6 +287,56 @@ void Parameters::display() {
 
   cout << "k-induction:\t- " << k_induction << endl;
 
+  cout << "Deepening:\t- " << deepening << endl;
+
+  cout << "Logical expression:\t- " << tree << endl;
+
+  cout << "Preprocessing:\t- " << preprocess << endl;
+
+  cout << "Pipe:\t- " << pipe << endl;
+
+  cout << "State encoding:\t- ";
+  if(stateEncoding == onehot) {
+    cout << "one-hot" << endl;
+  } else if(stateEncoding == logarithmic) {
+    cout << "log" << endl;
+  } else if(stateEncoding == order) {
+    cout << "order" << endl;
+  } else {
+    cout << "auto" << endl;
+  }
+
+  cout << "Transitions:\t- " << (transitionEncoding == selector ? "selector" : "rule") << endl;
+
+  cout << "At most one:\t- ";
+  if(atMostOne == cnf::Cardinality::Pairwise) {
+    cout << "pairwise" << endl;
+  } else if(atMostOne == cnf::Cardinality::Sequential) {
+    cout << "sequential" << endl;
+  } else if(atMostOne == cnf::Cardinality::Commander) {
+    cout << "commander" << endl;
+  } else if(atMostOne == cnf::Cardinality::Bimander) {
+    cout << "bimander" << endl;
+  } else if(atMostOne == cnf::Cardinality::Product) {
+    cout << "product" << endl;
+  } else {
+    cout << "auto" << endl;
+  }
+
+  cout << "Reduction:\t- " << reduce << endl;
+
+  cout << "Trace:\t- " << trace << endl;
+
+  cout << "Parallel:\t- " << parallel << " (lengths " << max(minBound, 1) << " to " << bound << ")" << endl;
+
+  cout << "Batch:\t- " << batch << " (" << nThreads << " threads)" << endl;
+
+  cout << "Budget:\t- " << timeout << " s, " << conflicts << " conflicts, " << memory << " MB" << endl;
+
+  cout << "Server:\t- " << server << (socket.empty() ? "" : " (" + socket + ")") << endl;
+
+  cout << "Steps:\t- " << (steps == interleaving ? "interleaving" : (steps == forall ? "forall" : "exists")) << endl;
+
   cout << endl << endl << endl;
 
 }
@@ -176,10 +359,29 @@ void Parameters::showHelp() {
   cout << "-h : show this help" << endl;
   // cout << "-e : encoding : SAT or ASP" << endl;
   cout << "-i : initial local state, ex: \"a=0, b=1, c=0\"" << endl;
-  cout << "-g : goal state, ex: \"a=2\"" << endl;
+  cout << "-g : goal state, ex: \"a=2\", or several local states to reach at the same time, ex: \"a=2, b=0\"" << endl;
   cout << "-s : sat solver: minisat, glucose" << endl << endl;
+  cout << "-portfolio : sat solvers run in parallel on each call, separated by commas, ex: \"minisat,glucose,minisat\", the first answer is kept and the other solvers are stopped, a solver repeated uses another seed" << endl;
   cout << "-d : debug information level, between 0 and 2" << endl;
-  cout << "-b : bound specified manually, > 1" << endl;
+  cout << "-b : bound specified manually, > 1, or a range of lengths \"min:max\" solved in parallel (implies -parallel)" << endl;
+  cout << "-parallel : solve several lengths of the path at the same time (up to the bound), the shortest path found is kept" << endl;
   cout << "-k_induction : apply the k-induction technique, a bound has to be specified" << endl;
+  cout << "-deepen : increase the length of the path one step at a time, up to the bound if there is one, -b or -timeout is required if the local causality graph contains cycles" << endl;
+  cout << "-trace : write the path found for a reachable goal, one global state per line (-server and -batch: on the answer line, separated by \" | \")" << endl;
+  cout << "-server : load the model once and answer the queries read on the standard input, one per line: \"initial state ; goal ; bound\"" << endl;
+  cout << "-socket : same as -server, the queries are read on the unix socket created at the given path" << endl;
+  cout << "-batch : answer the queries of a file (same format as -server) in parallel, one answer line per query in the order of the file" << endl;
+  cout << "-j : number of threads for -batch and -parallel, number of cores by default" << endl;
+  cout << "-timeout : wall-clock time limit of each query in seconds, the answer is unknown when it is reached" << endl;
+  cout << "-conflicts : conflict limit of each call of the linked SAT solvers (minisat, glucose), the answer is unknown when it is reached" << endl;
+  cout << "-memory : memory limit of the external SAT solver programs in MB, the answer is unknown when it is reached; refused when the solver is linked in aan_reach" << endl;
+  cout << "-no_reduce : encode the whole network instead of the automata, local states and transitions of the local causality graph" << endl;
+  cout << "-preprocess : simplify the cnf formula before solving (unit propagation, pure literals, subsumption, variable elimination), not used with -deepen, -server and -batch" << endl;
+  cout << "-pipe : write the formula on the standard input of the external SAT solver program instead of a temporary dimacs file" << endl;
+  cout << "-tree : build the logical expression and convert it to cnf instead of generating the clauses directly" << endl;
+  cout << "-state_encoding : coding of the local states: onehot, log, order or auto (chosen from the number of states of each automaton)" << endl;
+  cout << "-transitions : transition encoding: rule (activation rule of each local state) or selector (one variable per transition fired)" << endl;
+  cout << "-amo : encoding of the at most one constraints (transition selectors, local states): pairwise, sequential, commander, bimander, product or auto (chosen from the number of variables)" << endl;
+  cout << "-steps : step semantics: interleaving (one transition per step), forall or exists (parallel steps, implies -transitions selector, not available with -tree and -k_induction)" << endl;
 
 }
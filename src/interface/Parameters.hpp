@@ -10,6 +10,8 @@
 
 #include "../model/AN.hpp"
 
+#include "../logic/Cardinality.hpp"
+
 /*!
  * \brief Parameters class for the command line usage
  */
@@ -18,6 +20,9 @@ class Parameters {
   public:
     enum Encoding {undefined, ASP, SAT};
     enum Solver {minisat, glucose, maplecomsps, ccanr};
+    enum StateEncoding {onehot, logarithmic, order, automatic};
+    enum TransitionEncoding {rule, selector};
+    enum StepSemantics {interleaving, forall, exists};
 
   public:
 
@@ -54,17 +59,52 @@ class Parameters {
      */
     void showHelp();
 
+    /*
+     * \brief extract a context from the argument
+     * \param token the argument
+     * \param ctx the context modified
+     */
+    static void extractContext(std::string token, StrContext& ctx);
+
+    /*
+     * \brief get a SAT solver from its name
+     * \param name the name of the solver
+     * \param kind the solver, modified only if the name is known
+     * \return true if the name is known
+     */
+    static bool solverFromName(std::string name, Solver& kind);
+
   public:
 
     Encoding encoding; /* the encoding: SAT or ASP */
     Solver solver; /* the SAT solver chosen */
+    std::vector<Solver> portfolio; /* SAT solvers run in parallel on each call, the first answer is kept */
     std::string model; /* path of the automata network file */
     StrContext initialState; /* the initial state of the rechability problem */
     StrContext goal; /* the goal of the rechability problem */
     int debugLevel; /* level for debuging information */
     bool help; /* show the help */
     int bound; /* bound of the reachability sequence */
+    int minBound; /* smallest length of the range of bounds, none if <= 0 */
+    bool parallel; /* solve several lengths of the path at the same time */
     bool k_induction; /* apply k-induction technique */
+    bool deepening; /* increase the length of the path one step at a time */
+    bool trace; /* write the path of the reachable queries */
+    bool tree; /* build the logical expression instead of generating the clauses directly */
+    StateEncoding stateEncoding; /* coding of the local states of the automata */
+    TransitionEncoding transitionEncoding; /* activation rules or transition selectors */
+    StepSemantics steps; /* one transition per step, or parallel steps */
+    bool reduce; /* encode the network reduced to the local causality graph */
+    bool server; /* answer the queries read on the standard input or on a socket */
+    std::string socket; /* path of the unix socket of the server, standard input if empty */
+    std::string batch; /* path of a file of queries answered in parallel */
+    int nThreads; /* number of threads, number of cores if <= 0 */
+    bool preprocess; /* simplify the cnf formula before solving */
+    bool pipe; /* stream the formula to the external solver program instead of writing a file */
+    cnf::Cardinality::Method atMostOne; /* encoding of the at most one constraints */
+    double timeout; /* wall-clock time limit of each query in seconds, none if <= 0 */
+    int conflicts; /* conflict limit of each call of the linked solvers, none if <= 0 */
+    int memory; /* memory limit of the external solver programs in MB, none if <= 0 */
 
   private:
 
@@ -73,13 +113,6 @@ class Parameters {
      */
     Parameters();
 
-    /*
-     * \brief extract a context from the argument
-     * \param token the argument
-     * \param ctx the context modified
-     */
-    static void extractContext(std::string token, StrContext& ctx);
-
 
 };
 
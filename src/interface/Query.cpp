@@ -0,0 +1,286 @@
+/*!
+ * \file Query.cpp
+ * \brief implementation of the Query class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include <sstream>
+
+#include "Query.hpp"
+#include "Parameters.hpp"
+
+using namespace std;
+
+/*----------------------------------------------------------------------------*/
+Query::Query(AN& model, Context& initCtx, Context& finalCtx, int bound, bool reduce, LCG::SolutionCache* cache):
+_model(model),
+_initCtx(initCtx),
+_finalCtx(finalCtx),
+_bound(bound),
+_lcg(nullptr),
+_cycles(false),
+_lcgBound(-1),
+_reducedModel(nullptr),
+_encInitCtx(initCtx),
+_encFinalCtx(finalCtx),
+_encoding(nullptr),
+_bmc(nullptr),
+_witness(nullptr),
+_length(bound),
+_verbose(false),
+_answer(sat::Unknown)
+{
+
+  for(int autInd = 0; autInd < _model.nAutomata(); autInd ++) {
+    if(_finalCtx.at(autInd) != -1) {
+      _goals.push_back(LocalState(autInd, _finalCtx.at(autInd)));
+    }
+  }
+
+  if(_bound > 0 && !reduce) {
+    return;
+  }
+
+  _lcg = new LCG::Graph(_model, _initCtx, _goals);
+  if(cache != nullptr) {
+    _lcg->setSolutionCache(cache);
+  }
+  _lcg->build();
+
+  if(_bound <= 0) {
+    _cycles = _lcg->checkCycle();
+    if(!_cycles) {
+      _lcgBound = _lcg->computeBound();
+      _length = _lcgBound;
+    }
+  }
+
+  /* the path is encoded on the automata, local states and transitions of the LCG only */
+  if(reduce) {
+    _reducedModel = _lcg->reducedNetwork();
+    _lcg->reduceContext(_initCtx, _encInitCtx);
+    _lcg->reduceContext(_finalCtx, _encFinalCtx);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+Query::Status Query::status() {
+
+  Parameters& param = Parameters::getParameters();
+
+  Status res = ready;
+
+  if(_cycles && !param.deepening) {
+    res = boundNeeded;
+  } else if(_cycles && param.timeout <= 0) {
+    /* the deepening may not end before the number of global states, which can be huge */
+    res = timeoutNeeded;
+  }
+
+  return res;
+}
+
+/*----------------------------------------------------------------------------*/
+bool Query::cycles() {
+  return _cycles;
+}
+
+/*----------------------------------------------------------------------------*/
+int Query::lcgBound() {
+  return _lcgBound;
+}
+
+/*----------------------------------------------------------------------------*/
+void Query::setVerbose(bool verbose) {
+  _verbose = verbose;
+}
+
+/*----------------------------------------------------------------------------*/
+sat::Result Query::solve() {
+
+  Parameters& param = Parameters::getParameters();
+
+  AN& encoded = _reducedModel != nullptr ? *_reducedModel : _model;
+
+  if(param.deepening) {
+    _encoding = new Encoding(encoded);
+    _encoding->setVerbose(_verbose);
+    _answer = _encoding->deepening(_encInitCtx, _encFinalCtx, maxLength(encoded), _length);
+    _witness = _encoding;
+  } else if(param.parallel) {
+    _bmc = new ParallelBmc(encoded, _encInitCtx, _encFinalCtx);
+    _answer = _bmc->solve(param.minBound, _length, param.nThreads, _length);
+    if(_answer == sat::Sat) {
+      _witness = _bmc->shortest();
+      if(_verbose) {
+        _witness->setVerbose(true);
+        _witness->extractSolution(_answer, _length);
+      }
+    }
+  } else {
+    _encoding = new Encoding(encoded);
+    _encoding->setVerbose(_verbose);
+    _answer = _encoding->reachability(_encInitCtx, _encFinalCtx, _length);
+    _witness = _encoding;
+  }
+
+  return _answer;
+}
+
+/*----------------------------------------------------------------------------*/
+sat::Result Query::solve(Encoding& encoding) {
+
+  Parameters& param = Parameters::getParameters();
+
+  if(param.deepening) {
+    _answer = encoding.queryDeepening(_initCtx, _finalCtx, maxLength(_model), _length);
+  } else {
+    _answer = encoding.query(_initCtx, _finalCtx, _length);
+  }
+  _witness = &encoding;
+
+  return _answer;
+}
+
+/*----------------------------------------------------------------------------*/
+int Query::length() {
+  return _length;
+}
+
+/*----------------------------------------------------------------------------*/
+bool Query::trace(vector<Context>& path) {
+
+  if(_answer != sat::Sat || _witness == nullptr || !_witness->trace(_length, path)) {
+    return false;
+  }
+
+  /* the witness is given on the automata network of the query */
+  if(_reducedModel != nullptr) {
+    for(auto& ctx : path) {
+      Context reducedCtx = ctx;
+      _lcg->expandContext(reducedCtx, ctx);
+    }
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+string Query::answerLine() {
+
+  string res;
+
+  Status queryStatus = status();
+
+  if(queryStatus == boundNeeded) {
+    res = "error: the local causality graph contains cycles, a bound is needed";
+  } else if(queryStatus == timeoutNeeded) {
+    res = "error: the local causality graph contains cycles, a bound or -timeout is needed";
+  } else if(_answer == sat::Sat) {
+    res = "reachable";
+    vector<Context> path;
+    if(Parameters::getParameters().trace && trace(path)) {
+      res += " ;";
+      for(unsigned int ind = 0; ind < path.size(); ind ++) {
+        res += (ind == 0 ? " " : " | ") + _model.contextToString(path.at(ind));
+      }
+    }
+  } else if(_answer == sat::Unsat) {
+    if(_bound <= 0) {
+      res = "unreachable";
+    } else {
+      res = "unreachable for length " + to_string(_bound);
+    }
+  } else {
+    res = "unknown";
+  }
+
+  return res;
+}
+
+/*----------------------------------------------------------------------------*/
+int Query::maxLength(AN& model) {
+
+  int res = _length;
+
+  /* with cycles, no path is longer than the number of global states */
+  if(_cycles) {
+    res = model.nGlobalStates();
+  }
+
+  return res;
+}
+
+/*----------------------------------------------------------------------------*/
+string Query::parse(AN& model, string query, Context& initCtx, Context& finalCtx, int& bound) {
+
+  /* fields of the query */
+  vector<string> fields;
+  {
+    stringstream stream(query);
+    string field;
+    while(getline(stream, field, ';')) {
+      fields.push_back(field);
+    }
+  }
+
+  StrContext strInit, strGoal;
+  bound = -1;
+
+  if(fields.size() == 1) {
+    Parameters::extractContext(fields.at(0), strGoal);
+  } else if(fields.size() == 2 || fields.size() == 3) {
+    Parameters::extractContext(fields.at(0), strInit);
+    Parameters::extractContext(fields.at(1), strGoal);
+    if(fields.size() == 3 && fields.at(2).find_first_not_of(" \t\r") != string::npos) {
+      try {
+        bound = stoi(fields.at(2));
+      } catch(exception&) {
+        return "error: wrong bound";
+      }
+    }
+  } else {
+    return "error: wrong query";
+  }
+
+  if(strGoal.empty()) {
+    return "error: no goal specified";
+  }
+
+  initCtx = model.initialContext();
+  initCtx.resize(model.nAutomata(), -1);
+  finalCtx.assign(model.nAutomata(), -1);
+
+  if(!convertContext(model, strInit, initCtx) || !convertContext(model, strGoal, finalCtx)) {
+    return "error: unknown local state";
+  }
+
+  return "";
+}
+
+/*----------------------------------------------------------------------------*/
+bool Query::convertContext(AN& model, StrContext& strCtx, Context& ctx) {
+
+  for(auto& elt : strCtx) {
+    int autInd = model.getAutomatonIndex(elt.first);
+    if(autInd == -1) {
+      return false;
+    }
+    Automaton& aut = model.getAutomaton(autInd);
+    if(aut.stateIndex.find(elt.second) == aut.stateIndex.end()) {
+      return false;
+    }
+    ctx.at(autInd) = aut.stateIndex[elt.second];
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+Query::~Query() {
+  delete _encoding;
+  delete _bmc;
+  delete _lcg;
+  delete _reducedModel;
+}
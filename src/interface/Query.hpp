@@ -0,0 +1,163 @@
+/*!
+ * \file Query.hpp
+ * \brief class Query to answer one reachability query, shared by the command line, the server and the batch
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef QUERY_HPP
+#define QUERY_HPP
+
+#include <string>
+#include <vector>
+
+#include "../model/AN.hpp"
+#include "../encoding/Encoding.hpp"
+#include "../encoding/ParallelBmc.hpp"
+#include "../lcg/Graph.hpp"
+
+/*!
+ * \class Query
+ * \brief a reachability query: bound from the local causality graph, encoded network, search of the path and witness
+ *
+ * Without bound, the LCG gives one; when it contains cycles, -deepen and -timeout are needed and the length goes up to
+ * the number of global states. With -reduce, the path is encoded on the automata, local states and transitions of the LCG
+ * only, and the witness is expanded back to the network of the query.
+ */
+class Query {
+
+  public:
+
+    enum Status {ready, boundNeeded, timeoutNeeded};
+
+    /*!
+     * \brief constructor, build the local causality graph when it is needed
+     * \param model the automata network of the query
+     * \param initCtx the initial context
+     * \param finalCtx the final context
+     * \param bound the bound of the query, -1 if not specified
+     * \param reduce encode the network reduced to the local causality graph
+     * \param cache solutions of the objectives shared with the other queries on the network, nullptr if none
+     */
+    Query(AN& model, Context& initCtx, Context& finalCtx, int bound, bool reduce, LCG::SolutionCache* cache = nullptr);
+
+    /*!
+     * \brief destructor, free the graph, the encodings and the reduced network
+     */
+    ~Query();
+
+    /*!
+     * \brief tell if the query can be solved
+     * \return ready, or the option missing when the LCG contains cycles and there is no bound
+     */
+    Status status();
+
+    /*!
+     * \brief tell if the bound is missing and the LCG contains cycles
+     * \return true iff the length is increased up to the number of global states
+     */
+    bool cycles();
+
+    /*!
+     * \brief bound computed from the local causality graph
+     * \return the bound, -1 if there is a bound or if the LCG contains cycles
+     */
+    int lcgBound();
+
+    /*!
+     * \brief display the path found and the steps of the solving
+     * \param verbose true to display them
+     */
+    void setVerbose(bool verbose);
+
+    /*!
+     * \brief solve the query on its own encoding: deepening, lengths in parallel or one length, following the parameters
+     * \pre the status is ready
+     * \return the answer of the solver
+     */
+    sat::Result solve();
+
+    /*!
+     * \brief solve the query on an encoding of the whole network kept between the queries, the contexts are assumed
+     * \pre the status is ready and the network is not reduced
+     * \param encoding the encoding kept
+     * \return the answer of the solver
+     */
+    sat::Result solve(Encoding& encoding);
+
+    /*!
+     * \brief length of the path solved
+     * \return the length of the path found, or of the last path tried
+     */
+    int length();
+
+    /*!
+     * \brief witness of a reachable query
+     * \param path the global states of the path, on the network of the query, without the steps with no change
+     * \return false if there is no path
+     */
+    bool trace(std::vector<Context>& path);
+
+    /*!
+     * \brief answer line of the query for the server and the batch, with the witness if -trace is set
+     * \return "reachable", "unreachable", "unreachable for length n", "unknown" or "error: ...", ex: "reachable ; a=0,b=0 | a=1,b=0"
+     */
+    std::string answerLine();
+
+    /*!
+     * \brief read a query line "initial state ; goal ; bound", the initial state and the bound are optional
+     * \param model the automata network of the query
+     * \param query the query line
+     * \param initCtx the initial context
+     * \param finalCtx the final context
+     * \param bound the bound of the query, -1 if not specified
+     * \return an error line, empty if the query is correct
+     */
+    static std::string parse(AN& model, std::string query, Context& initCtx, Context& finalCtx, int& bound);
+
+  private:
+
+    /*!
+     * \brief greatest length tried by the deepening
+     * \param model the network encoded
+     * \return the bound, or the number of global states of the network when the LCG contains cycles
+     */
+    int maxLength(AN& model);
+
+    /*!
+     * \brief convert a string context, checking the names
+     * \param model the automata network
+     * \param strCtx the string context
+     * \param ctx the context completed
+     * \return false if a name is unknown
+     */
+    static bool convertContext(AN& model, StrContext& strCtx, Context& ctx);
+
+  private:
+
+    AN& _model; /* automata network of the query */
+
+    Context _initCtx; /* initial context */
+    Context _finalCtx; /* final context */
+    int _bound; /* bound of the query, -1 if not specified */
+    std::vector<LocalState> _goals; /* local states of the final context */
+
+    LCG::Graph* _lcg; /* local causality graph, built if there is no bound or if the network is reduced */
+    bool _cycles; /* no bound and the LCG contains cycles */
+    int _lcgBound; /* bound given by the LCG, -1 if none */
+
+    AN* _reducedModel; /* network reduced to the LCG, nullptr if the whole network is encoded */
+    Context _encInitCtx; /* initial context in the network encoded */
+    Context _encFinalCtx; /* final context in the network encoded */
+
+    Encoding* _encoding; /* own encoding of the query */
+    ParallelBmc* _bmc; /* lengths solved in parallel */
+    Encoding* _witness; /* encoding of the path found */
+
+    int _length; /* length of the path solved */
+    bool _verbose; /* display the path found */
+    sat::Result _answer; /* answer of the last solving */
+
+};
+
+#endif
@@ -0,0 +1,144 @@
+/*!
+ * \file Server.cpp
+ * \brief implementation of the Server class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "Server.hpp"
+#include "Parameters.hpp"
+#include "Query.hpp"
+
+using namespace std;
+
+/*----------------------------------------------------------------------------*/
+Server::Server(string model):
+_model(model),
+_encoding(_model)
+{
+
+}
+
+/*----------------------------------------------------------------------------*/
+void Server::run() {
+
+  Parameters& param = Parameters::getParameters();
+
+  if(param.socket.empty()) {
+    serve(cin);
+  } else {
+    serveSocket(param.socket);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+void Server::serve(istream& input) {
+
+  string line;
+
+  while(getline(input, line)) {
+    if(line.find_first_not_of(" \t\r") == string::npos) {
+      continue;
+    }
+    cout << answer(line) << endl;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+void Server::serveSocket(string path) {
+
+  int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path)-1);
+
+  unlink(path.c_str());
+
+  if(fd < 0 || ::bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0 || listen(fd, 1) < 0) {
+    cout << "error, the socket " << path << " cannot be created" << endl;
+    if(fd >= 0) {
+      close(fd);
+    }
+    return;
+  }
+
+  /* the clients are served one after the other, each one sends queries until it closes the connection */
+  while(true) {
+
+    int client = accept(fd, nullptr, nullptr);
+    if(client < 0) {
+      break;
+    }
+
+    string pending;
+    char buffer[4096];
+    ssize_t nRead;
+    bool connected = true;
+
+    while(connected && (nRead = read(client, buffer, sizeof(buffer))) > 0) {
+
+      pending.append(buffer, static_cast<size_t>(nRead));
+
+      size_t end;
+      while((end = pending.find('\n')) != string::npos) {
+        string line = pending.substr(0, end);
+        pending.erase(0, end+1);
+        if(line.find_first_not_of(" \t\r") == string::npos) {
+          continue;
+        }
+        string res = answer(line) + "\n";
+        /* a client that closed its connection is dropped (EPIPE), it does not stop the server with SIGPIPE */
+        size_t sent = 0;
+        while(sent < res.size()) {
+          ssize_t nSent = send(client, res.c_str()+sent, res.size()-sent, MSG_NOSIGNAL);
+          if(nSent < 0 && errno == EINTR) {
+            continue;
+          }
+          if(nSent <= 0) {
+            connected = false;
+            break;
+          }
+          sent += static_cast<size_t>(nSent);
+        }
+        if(!connected) {
+          break;
+        }
+      }
+    }
+
+    close(client);
+  }
+
+  close(fd);
+  unlink(path.c_str());
+}
+
+/*----------------------------------------------------------------------------*/
+string Server::answer(string query) {
+
+  Context initCtx, finalCtx;
+  int bound;
+
+  string error = Query::parse(_model, query, initCtx, finalCtx, bound);
+  if(!error.empty()) {
+    return error;
+  }
+
+  /* the whole network is encoded: the path is shared by all the queries */
+  Query current(_model, initCtx, finalCtx, bound, false, &_solutions);
+  if(current.status() == Query::ready) {
+    current.solve(_encoding);
+  }
+
+  return current.answerLine();
+}
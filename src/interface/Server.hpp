@@ -0,0 +1,73 @@
+/*!
+ * \file Server.hpp
+ * \brief class Server to answer reachability queries on a model loaded once
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef SERVER_HPP
+#define SERVER_HPP
+
+#include <string>
+#include <istream>
+
+#include "../model/AN.hpp"
+#include "../encoding/Encoding.hpp"
+#include "../lcg/Graph.hpp"
+
+/*!
+ * \class Server
+ * \brief keep the model, the objective solutions and the unrolled path between the queries
+ *
+ * A query is a line "initial state ; goal ; bound", the initial state and the bound are optional.
+ * The initial state completes the initial context of the model. The queries are answered by Query on the path kept
+ * between them: the whole network is encoded, it is not reduced to the LCG of each query.
+ * Each query gets one line: "reachable", "unreachable", "unreachable for length n", "unknown" or "error: ...".
+ */
+class Server {
+
+  public:
+
+    /*!
+     * \brief constructor
+     * \param model path of the automata network file
+     */
+    Server(std::string model);
+
+    /*!
+     * \brief answer the queries until the end of the input
+     */
+    void run();
+
+    /*!
+     * \brief answer a query
+     * \param query the query line
+     * \return the answer line
+     */
+    std::string answer(std::string query);
+
+  private:
+
+    /*!
+     * \brief answer the queries of a stream
+     * \param input the stream
+     */
+    void serve(std::istream& input);
+
+    /*!
+     * \brief answer the queries of the clients of a unix socket
+     * \param path path of the socket
+     */
+    void serveSocket(std::string path);
+
+  private:
+
+    AN _model; /* automata network of the queries */
+
+    LCG::SolutionCache _solutions; /* solutions of the objectives, shared by the LCG of all the queries */
+
+    Encoding _encoding; /* unrolled path and solver, kept between the queries */
+
+};
+
+#endif
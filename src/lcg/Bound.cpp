@@ -27,9 +27,20 @@ int Graph::computeBound() {
 
   std::vector<int> statut(_vertices.size(), 0);
   std::vector<int> bounds(_vertices.size(), -1);
-  computeBound(_root, statut, bounds);
 
-  return bounds.at(_root->index)+1;
+  /* the goals are reached one after the other: sum of the bounds of the roots
+   * a root without objective is already reached in the initial state */
+  int res = 1;
+  for(auto root : _roots) {
+    if(statut.at(root->index) != 2) {
+      computeBound(root, statut, bounds);
+    }
+    if(bounds.at(root->index) > 0) {
+      res += bounds.at(root->index);
+    }
+  }
+
+  return res;
 }
 
 
@@ -20,11 +20,11 @@ using namespace LCG;
 
 
 /*----------------------------------------------------------------------------*/
-Graph::Graph(AN& an, Context& initContext, LocalState& goalState):
+Graph::Graph(AN& an, Context& initContext, vector<LocalState>& goals):
 _an(an),
 _initContext(initContext),
-_goalState(goalState),
-_root(nullptr)
+_goals(goals),
+_cache(&_localCache)
 {
     setupMaps();
 }
@@ -38,8 +38,10 @@ void Graph::build() {
       cout << "creation of the local causality graph" << endl;
     }
 
-    /* add the goal local state */
-    _root = new VLocalState(this, _goalState.automaton, _goalState.state);
+    /* add the goal local states */
+    for(auto& goal : _goals) {
+        _roots.push_back(getVLocalState(goal.automaton, goal.state));
+    }
 
     bool change = false;
 
@@ -74,8 +76,8 @@ bool Graph::updateLocalState(VLocalState* vlocalState) {
         if(_vobjectiveMap.at(vlocalState->autInd).at(stateInd).at(vlocalState->stateInd) == nullptr) {
             /* check if the local state exists in the graph, or is the initial state (for all local states, there is an obj. from init local state) */
             if((_vlocalStateMap.at(vlocalState->autInd).at(stateInd) != nullptr) || _initContext.at(vlocalState->autInd) == stateInd) {
-                /* the origin of the objective is not the final state */
-                if( (vlocalState->autInd != _goalState.automaton) || (stateInd != _goalState.state) ) {
+                /* the origin of the objective is not the final state, a goal local state may have to be left if there are several goals */
+                if(_goals.size() > 1 || (vlocalState->autInd != _goals.front().automaton) || (stateInd != _goals.front().state) ) {
                     VObjective* vobj = new VObjective(this, vlocalState->autInd, stateInd, vlocalState->stateInd);
                     vlocalState->suc.push_back(vobj);
                     vobj->pred.push_back(vlocalState);
@@ -176,6 +178,166 @@ AN& Graph::automataNewtork() {
     return _an;
 }
 
+/*----------------------------------------------------------------------------*/
+AN* Graph::reducedNetwork() {
+
+    /* transitions used in the graph, and local states needed by these transitions */
+    vector<vector<bool>> keepTransition(_an.nAutomata());
+    vector<vector<bool>> keepState(_an.nAutomata());
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        keepTransition.at(autInd).resize(_an.getAutomaton(autInd).transitions.size(), false);
+        keepState.at(autInd).resize(_an.getAutomaton(autInd).nState, false);
+    }
+
+    for(auto vls : _vlocalStates) {
+        keepState.at(vls->autInd).at(vls->stateInd) = true;
+    }
+
+    for(auto vtr : _vtransitions) {
+        Transition& tr = _an.getAutomaton(vtr->autInd).transitions.at(vtr->trInd);
+        keepTransition.at(vtr->autInd).at(vtr->trInd) = true;
+        keepState.at(vtr->autInd).at(tr.origin) = true;
+        keepState.at(vtr->autInd).at(tr.target) = true;
+        for(auto& cond : tr.conditions) {
+            keepState.at(cond.first).at(cond.second) = true;
+        }
+    }
+
+    /* the initial local states of the remaining automata are kept */
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        bool used = find(keepState.at(autInd).begin(), keepState.at(autInd).end(), true) != keepState.at(autInd).end();
+        if(used && _initContext.at(autInd) != -1) {
+            keepState.at(autInd).at(_initContext.at(autInd)) = true;
+        }
+    }
+
+    /* index of the automata and local states in the reduced network */
+    _autMap.assign(_an.nAutomata(), -1);
+    _stateMap.assign(_an.nAutomata(), vector<int>());
+
+    AN* res = new AN();
+
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+
+        Automaton& aut = _an.getAutomaton(autInd);
+        _stateMap.at(autInd).resize(aut.nState, -1);
+
+        if(find(keepState.at(autInd).begin(), keepState.at(autInd).end(), true) == keepState.at(autInd).end()) {
+            continue;
+        }
+
+        _autMap.at(autInd) = res->nAutomata();
+        Automaton& reducedAut = res->createAutomaton(aut.name);
+
+        for(int stateInd = 0; stateInd < aut.nState; stateInd ++) {
+            if(keepState.at(autInd).at(stateInd)) {
+                _stateMap.at(autInd).at(stateInd) = reducedAut.nState;
+                reducedAut.stateName.push_back(aut.stateName.at(stateInd));
+                reducedAut.stateIndex.insert(pair<string, int>(aut.stateName.at(stateInd), reducedAut.nState));
+                reducedAut.nState += 1;
+            }
+        }
+    }
+
+    /* transitions, once all the automata are indexed */
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+
+        if(_autMap.at(autInd) == -1) {
+            continue;
+        }
+
+        Automaton& aut = _an.getAutomaton(autInd);
+        Automaton& reducedAut = res->getAutomaton(_autMap.at(autInd));
+
+        for(unsigned int trInd = 0; trInd < aut.transitions.size(); trInd ++) {
+            if(!keepTransition.at(autInd).at(trInd)) {
+                continue;
+            }
+            Transition& tr = aut.transitions.at(trInd);
+            Transition reducedTr;
+            reducedTr.origin = _stateMap.at(autInd).at(tr.origin);
+            reducedTr.target = _stateMap.at(autInd).at(tr.target);
+            for(auto& cond : tr.conditions) {
+                reducedTr.conditions.push_back(pair<int,int>(_autMap.at(cond.first), _stateMap.at(cond.first).at(cond.second)));
+            }
+            for(auto& sync : tr.synchro) {
+                if(_autMap.at(sync.first) != -1 && _stateMap.at(sync.first).at(sync.second) != -1) {
+                    reducedTr.synchro.push_back(pair<int,int>(_autMap.at(sync.first), _stateMap.at(sync.first).at(sync.second)));
+                }
+            }
+            reducedAut.transitions.push_back(reducedTr);
+        }
+    }
+
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        if(_autMap.at(autInd) != -1 && _initContext.at(autInd) != -1) {
+            res->setInitialState(_autMap.at(autInd), _stateMap.at(autInd).at(_initContext.at(autInd)));
+        }
+    }
+
+    Parameters& param = Parameters::getParameters();
+
+    if(param.debugLevel > 0) {
+        cout << "reduced network: " << res->nAutomata() << " automata (" << _an.nAutomata() << "), ";
+        cout << res->nLocalStates() << " local states (" << _an.nLocalStates() << "), ";
+        cout << res->nTransitions() << " transitions (" << _an.nTransitions() << ")" << endl;
+    }
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+void Graph::reduceContext(Context& ctx, Context& reducedCtx) {
+
+    reducedCtx.clear();
+
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        if(_autMap.at(autInd) != -1) {
+            if(ctx.at(autInd) != -1) {
+                reducedCtx.push_back(_stateMap.at(autInd).at(ctx.at(autInd)));
+            } else {
+                reducedCtx.push_back(-1);
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void Graph::expandContext(Context& reducedCtx, Context& ctx) {
+
+    /* the removed automata cannot change in the encoded path */
+    ctx = _initContext;
+
+    for(int autInd = 0; autInd < _an.nAutomata(); autInd ++) {
+        int reducedInd = _autMap.at(autInd);
+        if(reducedInd != -1 && reducedCtx.at(reducedInd) != -1) {
+            auto& states = _stateMap.at(autInd);
+            ctx.at(autInd) = static_cast<int>(find(states.begin(), states.end(), reducedCtx.at(reducedInd))-states.begin());
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void Graph::setSolutionCache(SolutionCache* cache) {
+    _cache = cache;
+}
+
+/*----------------------------------------------------------------------------*/
+vector<list<int>>* Graph::cachedSolutions(int autInd, int origin, int target) {
+    auto it = _cache->find(make_tuple(autInd, origin, target));
+    if(it == _cache->end()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+/*----------------------------------------------------------------------------*/
+vector<list<int>>* Graph::cacheSolutions(int autInd, int origin, int target, vector<list<int>>& solutions) {
+    vector<list<int>>& res = (*_cache)[make_tuple(autInd, origin, target)];
+    res = solutions;
+    return &res;
+}
+
 /*----------------------------------------------------------------------------*/
 int Graph::nVertices() {
     return static_cast<int>(_vertices.size());
@@ -230,7 +392,9 @@ bool Graph::checkCycle() {
   vector<unsigned int> statut(_vertices.size(), 0);
 
   stack<Vertex*> pending;
-  pending.push(_root);
+  for(auto root : _roots) {
+    pending.push(root);
+  }
 
   while(!cycle && !pending.empty()) {
 
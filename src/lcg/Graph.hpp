@@ -13,9 +13,17 @@
 #include "VObjective.hpp"
 
 #include <vector>
+#include <list>
+#include <map>
+#include <tuple>
 
 namespace LCG {
 
+/*!
+ * \brief solutions of the objectives: transition sequences for each (automaton, origin, target)
+ */
+typedef std::map<std::tuple<int, int, int>, std::vector<std::list<int>>> SolutionCache;
+
 /*
  * \class Graph
  * \brief Local causality graph of a specific accessibility problem, gives informations on the solution
@@ -28,9 +36,9 @@ class Graph {
          * \brief contructor
          * \param an the automata network of the problem
          * \param initContext the initial context of the problem
-         * \param goal state the local state to reach
+         * \param goals the local states to reach simultaneously, one root of the graph each
          */
-        Graph(AN& an, Context& initContext, LocalState& goalState);
+        Graph(AN& an, Context& initContext, std::vector<LocalState>& goals);
 
         /*!
          * \brief build the local causality graph
@@ -80,11 +88,53 @@ class Graph {
         AN& automataNewtork();
 
         /*!
-         * \brief get the reduced automata network
-         * \return the reduced automata network
+         * \brief get the reduced automata network: automata, local states and transitions of the graph
+         * \pre the graph is built
+         * \return the reduced automata network, to be deleted by the caller
          */
         AN* reducedNetwork();
 
+        /*!
+         * \brief convert a context of the network into a context of the reduced network
+         * \pre the reduced network has been created
+         * \param ctx the context in the network
+         * \param reducedCtx the context in the reduced network
+         */
+        void reduceContext(Context& ctx, Context& reducedCtx);
+
+        /*!
+         * \brief convert a context of the reduced network back into a context of the network, the automata removed keep their initial local state
+         * \pre the reduced network has been created
+         * \param reducedCtx the context in the reduced network
+         * \param ctx the context in the network
+         */
+        void expandContext(Context& reducedCtx, Context& ctx);
+
+        /*!
+         * \brief use a cache of objective solutions shared with other graphs of the same network
+         * \param cache the cache
+         */
+        void setSolutionCache(SolutionCache* cache);
+
+        /*!
+         * \brief get the solutions of an objective if they have already been computed
+         * \param autInd the automaton index
+         * \param origin the origin state
+         * \param target the target state
+         * \return the transition sequences, nullptr if they are unknown
+         */
+        std::vector<std::list<int>>* cachedSolutions(int autInd, int origin, int target);
+
+        /*!
+         * \brief store the solutions of an objective
+         * \param autInd the automaton index
+         * \param origin the origin state
+         * \param target the target state
+         * \param solutions the transition sequences
+         * \return the stored transition sequences
+         */
+        std::vector<std::list<int>>* cacheSolutions(int autInd, int origin, int target, std::vector<std::list<int>>& solutions);
+
         /*!
          * \brief get the number of vertices in the graph
          * \return the number of vertices
@@ -148,9 +198,16 @@ class Graph {
         AN& _an; /* automata network of the problem */
         Context& _initContext; /* initial context of the reachability problem */
 
-        LocalState& _goalState; /* goal local state */
+        std::vector<LocalState> _goals; /* goal local states */
+
+        std::vector<VLocalState*> _roots; /* "roots" of the graph: the goal local states */
+
+        SolutionCache _localCache; /* solutions of the objectives, if no cache is shared */
+        SolutionCache* _cache; /* solutions of the objectives */
 
-        VLocalState* _root; /* "root" of the graph */
+        /* index of the automata and the local states in the reduced network, -1 if removed */
+        std::vector<int> _autMap;
+        std::vector<std::vector<int>> _stateMap;
 };
 
 
@@ -44,22 +44,30 @@ void VObjective::solve() {
         VSolution* vsol = new VSolution(graph);
         suc.push_back(vsol);
         vsol->pred.push_back(this);
-    } else { /* find the scenario associated to the solutions */
-        recursiveSolve(sequence, visited);
+    } else { /* find the scenario associated to the solutions, they only depend on the automaton */
+        vector<list<int>>* solutions = graph->cachedSolutions(autInd, originState, targetState);
+        if(solutions == nullptr) {
+            vector<list<int>> newSolutions;
+            recursiveSolve(sequence, visited, newSolutions);
+            solutions = graph->cacheSolutions(autInd, originState, targetState, newSolutions);
+        }
+        for(auto& trSequence : *solutions) {
+            VSolution* vsol = new VSolution(graph, autInd, trSequence);
+            suc.push_back(vsol);
+            vsol->pred.push_back(this);
+        }
     }
 
 }
 
 /*----------------------------------------------------------------------------*/
-void VObjective::recursiveSolve(list<int>& sequence, vector<bool>& visited) {
+void VObjective::recursiveSolve(list<int>& sequence, vector<bool>& visited, vector<list<int>>& solutions) {
 
     Automaton& aut = graph->automataNewtork().getAutomaton(autInd);
 
     /* base case */
     if(!sequence.empty() && aut.transitions.at(sequence.back()).target == targetState) {
-        VSolution* vsol = new VSolution(graph, autInd, sequence);
-        suc.push_back(vsol);
-        vsol->pred.push_back(this);
+        solutions.push_back(sequence);
     } else {
 
         /* recursive call for every possible transition */
@@ -78,7 +86,7 @@ void VObjective::recursiveSolve(list<int>& sequence, vector<bool>& visited) {
             if(valid) {
                 visited.at(tr.target) = true;
                 sequence.push_back(trInd);
-                recursiveSolve(sequence, visited);
+                recursiveSolve(sequence, visited, solutions);
                 sequence.pop_back();
                 visited.at(tr.target) = false;
             }
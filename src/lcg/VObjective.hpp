@@ -44,8 +44,9 @@ namespace LCG {
              * \brief recursive solve the objective : find the transition sequence to achieve the objective
              * \param sequence of transition indexes
              * \param visited visited local states
+             * \param solutions the transition sequences found
              */
-            void recursiveSolve(std::list<int>& sequence, std::vector<bool>& visited);
+            void recursiveSolve(std::list<int>& sequence, std::vector<bool>& visited, std::vector<std::list<int>>& solutions);
 
         public:
 
@@ -0,0 +1,182 @@
+/*!
+ * \file Cardinality.cpp
+ * \brief implementation of the Cardinality class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include <cmath>
+
+#include "Cardinality.hpp"
+
+using namespace std;
+using namespace cnf;
+
+/* greatest number of literals encoded pairwise by the recursive encodings and the automatic choice */
+const size_t maxPairwise = 4;
+
+/* greatest number of literals encoded by a sequential counter in the automatic choice */
+const size_t maxSequential = 32;
+
+/*----------------------------------------------------------------------------*/
+Cardinality::Cardinality(CnfExpression& cnfEx, Method method):
+_cnfEx(cnfEx),
+_method(method)
+{
+
+}
+
+/*----------------------------------------------------------------------------*/
+Cardinality::Method Cardinality::choose(size_t nLit) {
+    if(nLit <= maxPairwise) {
+        return Pairwise;
+    } else if(nLit <= maxSequential) {
+        return Sequential;
+    } else {
+        return Product;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void Cardinality::atLeastOne(const vector<int>& lits) {
+    _cnfEx.addClause(lits);
+}
+
+/*----------------------------------------------------------------------------*/
+void Cardinality::atMostOne(const vector<int>& lits) {
+
+    if(lits.size() <= 1) {
+        return;
+    }
+
+    Method method = (_method == Automatic ? choose(lits.size()) : _method);
+
+    switch(method) {
+        case Sequential:
+            sequential(lits);
+            break;
+        case Commander:
+            commander(lits);
+            break;
+        case Bimander:
+            bimander(lits);
+            break;
+        case Product:
+            product(lits);
+            break;
+        default:
+            pairwise(lits);
+            break;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void Cardinality::exactlyOne(const vector<int>& lits) {
+    atLeastOne(lits);
+    atMostOne(lits);
+}
+
+/*----------------------------------------------------------------------------*/
+void Cardinality::pairwise(const vector<int>& lits) {
+    for(unsigned int ind1 = 0; ind1 < lits.size(); ind1 ++) {
+        for(unsigned int ind2 = ind1+1; ind2 < lits.size(); ind2 ++) {
+            _cnfEx.addClause({-lits.at(ind1), -lits.at(ind2)});
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void Cardinality::sequential(const vector<int>& lits) {
+
+    /* count is true if one of the first ind+1 literals is true */
+    int prev = 0;
+    for(unsigned int ind = 0; ind+1 < lits.size(); ind ++) {
+        int count = _cnfEx.addVariable();
+        _cnfEx.addClause({-lits.at(ind), count});
+        if(prev != 0) {
+            _cnfEx.addClause({-prev, count});
+            _cnfEx.addClause({-prev, -lits.at(ind)});
+        }
+        prev = count;
+    }
+    _cnfEx.addClause({-prev, -lits.back()});
+}
+
+/*----------------------------------------------------------------------------*/
+void Cardinality::commander(const vector<int>& lits) {
+
+    if(lits.size() <= maxPairwise) {
+        pairwise(lits);
+        return;
+    }
+
+    /* the commander of a group is true if one of its literals is true */
+    vector<int> commanders;
+    for(unsigned int begin = 0; begin < lits.size(); begin += 3) {
+        vector<int> group(lits.begin()+begin, lits.begin()+min<size_t>(begin+3, lits.size()));
+        pairwise(group);
+        int com = _cnfEx.addVariable();
+        for(int lit : group) {
+            _cnfEx.addClause({-lit, com});
+        }
+        commanders.push_back(com);
+    }
+
+    commander(commanders);
+}
+
+/*----------------------------------------------------------------------------*/
+void Cardinality::bimander(const vector<int>& lits) {
+
+    size_t nGroup = (lits.size()+1)/2;
+
+    int nBit = 0;
+    while((static_cast<size_t>(1) << nBit) < nGroup) {
+        nBit ++;
+    }
+
+    vector<int> bits;
+    for(int bit = 0; bit < nBit; bit ++) {
+        bits.push_back(_cnfEx.addVariable());
+    }
+
+    /* a true literal forces the code of its group */
+    for(unsigned int group = 0; group < nGroup; group ++) {
+        vector<int> members(lits.begin()+2*group, lits.begin()+min<size_t>(2*group+2, lits.size()));
+        pairwise(members);
+        for(int lit : members) {
+            for(int bit = 0; bit < nBit; bit ++) {
+                _cnfEx.addClause({-lit, ((group >> bit) & 1) == 1 ? bits.at(bit) : -bits.at(bit)});
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void Cardinality::product(const vector<int>& lits) {
+
+    if(lits.size() <= maxPairwise) {
+        pairwise(lits);
+        return;
+    }
+
+    size_t nRow = static_cast<size_t>(ceil(sqrt(static_cast<double>(lits.size()))));
+    size_t nCol = (lits.size()+nRow-1)/nRow;
+
+    vector<int> rows, cols;
+    for(unsigned int row = 0; row < nRow; row ++) {
+        rows.push_back(_cnfEx.addVariable());
+    }
+    for(unsigned int col = 0; col < nCol; col ++) {
+        cols.push_back(_cnfEx.addVariable());
+    }
+
+    /* two literals differ by their row or their column */
+    for(unsigned int ind = 0; ind < lits.size(); ind ++) {
+        _cnfEx.addClause({-lits.at(ind), rows.at(ind / nCol)});
+        _cnfEx.addClause({-lits.at(ind), cols.at(ind % nCol)});
+    }
+
+    product(rows);
+    product(cols);
+}
@@ -0,0 +1,105 @@
+/*!
+ * \file Cardinality.hpp
+ * \brief cnf encodings of the at most one and exactly one constraints
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef CNF_CARDINALITY_HPP
+#define CNF_CARDINALITY_HPP
+
+#include <vector>
+#include <cstddef>
+
+#include "CnfExpression.hpp"
+
+namespace cnf {
+
+/*!
+ * \class Cardinality
+ * \brief add cardinality constraints on literals into a cnf expression, the auxiliary variables are created in the expression
+ */
+class Cardinality {
+
+    public:
+
+        /* encoding of the at most one constraints */
+        enum Method {Pairwise, Sequential, Commander, Bimander, Product, Automatic};
+
+    public:
+
+        /*!
+         * \brief constructor
+         * \param cnfEx the cnf expression receiving the clauses
+         * \param method encoding of the at most one constraints, chosen from the number of literals if Automatic
+         */
+        Cardinality(CnfExpression& cnfEx, Method method = Automatic);
+
+        /*!
+         * \brief at least one of the literals is true
+         * \param lits the literals
+         */
+        void atLeastOne(const std::vector<int>& lits);
+
+        /*!
+         * \brief at most one of the literals is true
+         * \param lits the literals
+         */
+        void atMostOne(const std::vector<int>& lits);
+
+        /*!
+         * \brief exactly one of the literals is true
+         * \param lits the literals
+         */
+        void exactlyOne(const std::vector<int>& lits);
+
+        /*!
+         * \brief encoding used for a number of literals when the method is Automatic
+         * \param nLit the number of literals
+         * \return the encoding
+         */
+        static Method choose(std::size_t nLit);
+
+    private:
+
+        /*!
+         * \brief one binary clause per pair of literals: n(n-1)/2 clauses, no variable
+         * \param lits the literals
+         */
+        void pairwise(const std::vector<int>& lits);
+
+        /*!
+         * \brief sequential counter: 3n-4 clauses, n-1 variables
+         * \param lits the literals
+         */
+        void sequential(const std::vector<int>& lits);
+
+        /*!
+         * \brief groups of 3 literals with a commander variable, at most one commander recursively: about 3n clauses, n/2 variables
+         * \param lits the literals
+         */
+        void commander(const std::vector<int>& lits);
+
+        /*!
+         * \brief groups of 2 literals, the index of the group is coded in binary: about n log(n) clauses, log(n) variables
+         * \param lits the literals
+         */
+        void bimander(const std::vector<int>& lits);
+
+        /*!
+         * \brief the literals are placed in a grid, at most one row and one column recursively: about 2n clauses, 2 sqrt(n) variables
+         * \param lits the literals
+         */
+        void product(const std::vector<int>& lits);
+
+    private:
+
+        CnfExpression& _cnfEx; /* clauses of the constraints */
+
+        Method _method; /* encoding of the at most one constraints */
+
+};
+
+}
+
+#endif /* CNF_CARDINALITY_HPP */
@@ -5,10 +5,13 @@
  * \date 21/03/2018
  */
 
-#include <fstream>
 #include <iostream>
+#include <cstdlib>
 
 #include "CnfExpression.hpp"
+#include "DimacsWriter.hpp"
+
+#include "../sat/Solver.hpp"
 
 using namespace std;
 using namespace cnf;
@@ -18,169 +21,106 @@ using namespace cnf;
 /******************************************************************************/
 
 /*----------------------------------------------------------------------------*/
-CnfExpression::CnfExpression()
+CnfExpression::CnfExpression():
+_offsets(1, 0),
+_nVar(0),
+_nClause(0),
+_solver(nullptr),
+_retain(true)
 {
 
 }
 
 /*----------------------------------------------------------------------------*/
-CnfExpression::CnfExpression(string fileName) {
-
-}
-
-/*----------------------------------------------------------------------------*/
-int CnfExpression::addVariable(Variable* var) {
-    _variables.push_back(var);
-    return static_cast<int>(_variables.size()-1);
-}
+CnfExpression::CnfExpression(string fileName):
+_offsets(1, 0),
+_nVar(0),
+_nClause(0),
+_solver(nullptr),
+_retain(true)
+{
 
-/*----------------------------------------------------------------------------*/
-void CnfExpression::addClause(Clause* clause) {
-    _clauses.push_back(clause);
 }
 
 /*----------------------------------------------------------------------------*/
-int CnfExpression::nVar() {
-    return static_cast<int>(_variables.size());
+int CnfExpression::addVariable() {
+    return ++ _nVar;
 }
 
 /*----------------------------------------------------------------------------*/
-int CnfExpression::nClause() {
-    return static_cast<int>(_clauses.size());
-}
-
-/*----------------------------------------------------------------------------*/
-string CnfExpression::toString() {
-    string res = "";
-    for(auto clause : _clauses) {
-        res += clause->toString() + "\n";
+void CnfExpression::addClause(const vector<int>& clause) {
+    _nClause ++;
+    if(_retain) {
+        _literals.insert(_literals.end(), clause.begin(), clause.end());
+        _offsets.push_back(_literals.size());
     }
-    return res;
-}
-
-/*----------------------------------------------------------------------------*/
-void CnfExpression::exportDimacs(std::string fileName) {
-    ofstream file(fileName);
-    if(file) {
-        /* first line : number of variables and number of clauses */
-        file << "p cnf " + to_string(_variables.size()) + " " + to_string(_clauses.size()) + "\n";
-        /* clauses */
-        for(auto cl : _clauses) {
-            for(auto lit : cl->literals()) {
-                if(!lit.positive()) {
-                    file << "-";
-                }
-                file << to_string(lit.variable().index()+1) << " ";
-            }
-            file << "0\n";
+    if(_solver != nullptr) {
+        for(int lit : clause) {
+            _solver->add(lit);
         }
-        file.close();
-    }
-}
-
-/*----------------------------------------------------------------------------*/
-CnfExpression::~CnfExpression() {
-
-    for(auto clause : _clauses) {
-        delete clause;
-    }
-
-    for(auto var : _variables) {
-        delete var;
+        _solver->add(0);
     }
-
 }
 
-
-/******************************************************************************/
-/*---------------------------- class Variable --------------------------------*/
-/******************************************************************************/
-
 /*----------------------------------------------------------------------------*/
-Variable::Variable(CnfExpression& ex):
-_ex(ex)
-{
-    _ind = _ex.addVariable(this);
+void CnfExpression::setSolver(sat::Solver* solver, bool retain) {
+    _solver = solver;
+    _retain = retain || solver == nullptr;
 }
 
 /*----------------------------------------------------------------------------*/
-string Variable::toString() {
-    return "x_" + to_string(_ind);
+int CnfExpression::nVar() {
+    return _nVar;
 }
 
 /*----------------------------------------------------------------------------*/
-CnfExpression& Variable::expression() {
-    return _ex;
+int CnfExpression::nClause() {
+    return _nClause;
 }
 
 /*----------------------------------------------------------------------------*/
-int Variable::index() {
-    return _ind;
+const vector<int>& CnfExpression::literals() {
+    return _literals;
 }
 
-
-
-/******************************************************************************/
-/*---------------------------- class Literal ---------------------------------*/
-/******************************************************************************/
-
 /*----------------------------------------------------------------------------*/
-Literal::Literal(Variable* var, bool pos):
-_var(*var),
-_pos(pos)
-{
-
+const vector<size_t>& CnfExpression::offsets() {
+    return _offsets;
 }
 
 /*----------------------------------------------------------------------------*/
-string Literal::toString() {
+string CnfExpression::toString() {
     string res = "";
-    if(!_pos) {
-        res += "not ";
+    for(size_t clause = 0; clause+1 < _offsets.size(); clause ++) {
+        res += "(";
+        for(size_t ind = _offsets.at(clause); ind < _offsets.at(clause+1); ind ++) {
+            if(_literals.at(ind) < 0) {
+                res += "not ";
+            }
+            res += "x_" + to_string(abs(_literals.at(ind)));
+            if(ind+1 < _offsets.at(clause+1)) {
+                res += " or ";
+            }
+        }
+        res += ")\n";
     }
-    res += _var.toString();
     return res;
 }
 
 /*----------------------------------------------------------------------------*/
-Variable& Literal::variable() {
-    return _var;
-}
-
-/*----------------------------------------------------------------------------*/
-bool Literal::positive() {
-    return _pos;
-}
-
-
-
-
-
-/******************************************************************************/
-/*----------------------------- class Clause ---------------------------------*/
-/******************************************************************************/
-
-/*----------------------------------------------------------------------------*/
-Clause::Clause(std::vector<Literal> lit):
-_lit(lit)
-{
-    _lit.front().variable().expression().addClause(this);
-}
-
-/*----------------------------------------------------------------------------*/
-string Clause::toString() {
-    string res = "(";
-    for(unsigned int i = 0; i < _lit.size(); i++) {
-        res += _lit.at(i).toString();
-        if(i < _lit.size()-1) {
-            res += " or ";
+void CnfExpression::exportDimacs(std::string fileName) {
+    DimacsWriter writer(fileName);
+    if(writer.isOpen()) {
+        /* first line : number of variables and number of clauses */
+        writer.header(_nVar, static_cast<int>(_offsets.size()-1));
+        /* clauses */
+        for(size_t clause = 0; clause+1 < _offsets.size(); clause ++) {
+            writer.clause(_literals.data()+_offsets.at(clause), _literals.data()+_offsets.at(clause+1));
         }
     }
-    res += ")";
-    return res;
 }
 
 /*----------------------------------------------------------------------------*/
-vector<Literal>& Clause::literals() {
-    return _lit;
+CnfExpression::~CnfExpression() {
+
 }
@@ -10,15 +10,27 @@
 
 #include <vector>
 #include <string>
+#include <cstddef>
+
+namespace sat {
+    class Solver;
+}
 
 namespace cnf {
 
-class Clause;
-class Variable;
+/*!
+ * \brief literal of a variable
+ * \param var the variable (positive integer)
+ * \param pos false if there is a negation
+ * \return the literal: the variable, negative if there is a negation
+ */
+inline int literal(int var, bool pos = true) {
+    return pos ? var : -var;
+}
 
 /*!
  * \class CnfExpression
- * \brief cnf logical formula
+ * \brief cnf logical formula, the variables are positive integers and the literals signed integers (Dimacs style)
  */
 class CnfExpression {
 
@@ -37,15 +49,22 @@ class CnfExpression {
 
         /*!
          * \brief create a new variable for the expression
-         * \return the index of the variable
+         * \return the variable, from 1
          */
-        int addVariable(Variable* var);
+        int addVariable();
 
         /*!
          * \brief add a clause into the formula
-         * \param clause the clause
+         * \param clause the literals of the clause
          */
-        void addClause(Clause* clause);
+        void addClause(const std::vector<int>& clause);
+
+        /*!
+         * \brief forward the clauses to a SAT solver as soon as they are added
+         * \param solver the solver, nullptr to stop forwarding
+         * \param retain false if the clauses are only given to the solver, not kept in the expression
+         */
+        void setSolver(sat::Solver* solver, bool retain = true);
 
         /*!
          * \brief number of variable in the expression
@@ -60,42 +79,16 @@ class CnfExpression {
         int nClause();
 
         /*!
-         * \brief convert to a string
-         * \return the string
-         */
-        std::string toString();
-
-        /*!
-         * \brief export to the Dimacs format
-         * \param fileName name of the file
-         */
-        void exportDimacs(std::string fileName);
-
-        /*!
-         * \brief destructor
+         * \brief literals of all the clauses kept in the expression, one after the other
+         * \return the literals
          */
-        ~CnfExpression();
-
-    private:
-
-        std::vector<Clause*> _clauses;
-        std::vector<Variable*> _variables;
-
-};
-
-/*!
- * \class Variable
- * \brief cnf variable
- */
-class Variable {
-
-    public:
+        const std::vector<int>& literals();
 
         /*!
-         * \brief constructor
-         * \param ex the expression of the variable
+         * \brief position of each clause in the literals, followed by the number of literals
+         * \return the offsets, clause i is [offsets[i], offsets[i+1])
          */
-        Variable(CnfExpression& ex);
+        const std::vector<std::size_t>& offsets();
 
         /*!
          * \brief convert to a string
@@ -104,96 +97,28 @@ class Variable {
         std::string toString();
 
         /*!
-         * \brief get the expression of the variable
-         * \return the expression
-         */
-        CnfExpression& expression();
-
-        /*!
-         * \brief get the index of the variable
-         * \return the index
-         */
-        int index();
-
-    private:
-        int _ind;
-        CnfExpression& _ex;
-};
-
-
-/*!
- * \class Literal
- * \brief Literal of a clause, can be a variable or its negation
- */
-class Literal {
-
-    public:
-
-        /*!
-         * \brief constructor
-         * \param var the variable of the literal
-         * \param pos false if there is a negation
-         */
-        Literal(Variable* var, bool pos = true);
-
-        /*!
-         * \brief variable of the literal
-         * \return the variable
-         */
-        Variable& variable();
-
-        /*!
-         * \brief indicate if the literal is positive or not
-         * \return true iff the literal si positive
+         * \brief export to the Dimacs format
+         * \param fileName name of the file
          */
-        bool positive();
+        void exportDimacs(std::string fileName);
 
         /*!
-         * \brief convert to a string
-         * \return the string
+         * \brief destructor
          */
-        std::string toString();
+        ~CnfExpression();
 
     private:
 
-        Variable& _var;
-        bool _pos; /* positive or negative literal */
-
-};
+        std::vector<int> _literals; /* literals of the clauses */
+        std::vector<std::size_t> _offsets; /* start of each clause in the literals, and the end of the last one */
+        int _nVar; /* number of variables */
+        int _nClause; /* number of clauses added, kept or not */
 
-class Clause {
-
-    public:
-
-        /*!
-         * \brief constructor
-         * \param lit the literals of the clause
-         */
-        Clause(std::vector<Literal> lit);
-
-        /*!
-         * \brief convert to a string
-         * \return the string
-         */
-        std::string toString();
-
-        /*!
-         * \brief get a reference of the literals
-         * \return the literals
-         */
-        std::vector<Literal>& literals();
-
-    private:
-        std::vector<Literal> _lit; /* list of literals in the clause */
+        sat::Solver* _solver; /* solver receiving the clauses, if any */
+        bool _retain; /* the clauses are kept in the expression */
 
 };
 
-
-
-
-
-
-
 }
 
 
@@ -0,0 +1,153 @@
+/*!
+ * \file DimacsWriter.cpp
+ * \brief implementation of the DimacsWriter class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include <unistd.h>
+
+#include "DimacsWriter.hpp"
+
+using namespace std;
+using namespace cnf;
+
+/* size of the buffer, flushed when less than one literal can be added */
+const size_t bufferSize = 1 << 20;
+
+/* maximal size of an integer written: sign, 10 digits and a separator */
+const size_t maxIntegerSize = 12;
+
+/* size of a fixed header line, with the line break */
+const size_t fixedHeaderSize = 32;
+
+/*----------------------------------------------------------------------------*/
+DimacsWriter::DimacsWriter(string fileName):
+_file(fopen(fileName.c_str(), "w")),
+_owner(true),
+_buffer(new char[bufferSize]),
+_size(0)
+{
+
+}
+
+/*----------------------------------------------------------------------------*/
+DimacsWriter::DimacsWriter(FILE* file):
+_file(file),
+_owner(false),
+_buffer(new char[bufferSize]),
+_size(0)
+{
+
+}
+
+/*----------------------------------------------------------------------------*/
+bool DimacsWriter::isOpen() {
+    return _file != nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+void DimacsWriter::header(int nVar, int nClause) {
+    const char prefix[] = "p cnf ";
+    for(size_t ind = 0; ind+1 < sizeof(prefix); ind ++) {
+        _buffer[_size ++] = prefix[ind];
+    }
+    integer(nVar);
+    _buffer[_size ++] = ' ';
+    integer(nClause);
+    _buffer[_size ++] = '\n';
+}
+
+/*----------------------------------------------------------------------------*/
+void DimacsWriter::fixedHeader(int nVar, int nClause) {
+
+    long pos = position();
+    if(pos > 0) {
+        fseek(_file, 0, SEEK_SET);
+    }
+
+    /* the parsers skip the spaces at the end of the line */
+    header(nVar, nClause);
+    _size --;
+    while(_size+1 < fixedHeaderSize) {
+        _buffer[_size ++] = ' ';
+    }
+    _buffer[_size ++] = '\n';
+
+    if(pos > 0) {
+        flush();
+        fseek(_file, pos, SEEK_SET);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+long DimacsWriter::position() {
+    flush();
+    return _file != nullptr ? ftell(_file) : 0;
+}
+
+/*----------------------------------------------------------------------------*/
+void DimacsWriter::truncate(long pos) {
+    flush();
+    if(_file != nullptr) {
+        if(ftruncate(fileno(_file), pos) == 0) {
+            fseek(_file, pos, SEEK_SET);
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void DimacsWriter::integer(int val) {
+
+    if(_size + maxIntegerSize > bufferSize) {
+        flush();
+    }
+
+    /* the digits are computed from the last one */
+    unsigned int abs = static_cast<unsigned int>(val < 0 ? -static_cast<long long>(val) : val);
+    char digits[maxIntegerSize];
+    int nDigit = 0;
+    do {
+        digits[nDigit ++] = static_cast<char>('0' + abs % 10);
+        abs /= 10;
+    } while(abs > 0);
+
+    if(val < 0) {
+        _buffer[_size ++] = '-';
+    }
+    while(nDigit > 0) {
+        _buffer[_size ++] = digits[-- nDigit];
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void DimacsWriter::literal(int lit) {
+    integer(lit);
+    _buffer[_size ++] = (lit == 0 ? '\n' : ' ');
+}
+
+/*----------------------------------------------------------------------------*/
+void DimacsWriter::clause(const int* begin, const int* end) {
+    for(const int* it = begin; it != end; it ++) {
+        literal(*it);
+    }
+    literal(0);
+}
+
+/*----------------------------------------------------------------------------*/
+void DimacsWriter::flush() {
+    if(_file != nullptr && _size > 0) {
+        fwrite(_buffer, 1, _size, _file);
+        fflush(_file);
+    }
+    _size = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+DimacsWriter::~DimacsWriter() {
+    flush();
+    if(_owner && _file != nullptr) {
+        fclose(_file);
+    }
+    delete[] _buffer;
+}
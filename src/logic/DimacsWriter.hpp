@@ -0,0 +1,114 @@
+/*!
+ * \file DimacsWriter.hpp
+ * \brief buffered output of cnf formulas in the Dimacs format
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef CNF_DIMACS_WRITER_HPP
+#define CNF_DIMACS_WRITER_HPP
+
+#include <cstdio>
+#include <string>
+
+namespace cnf {
+
+/*!
+ * \class DimacsWriter
+ * \brief write a Dimacs formula into a file or a pipe, the integers are formatted by hand into a large buffer
+ */
+class DimacsWriter {
+
+    public:
+
+        /*!
+         * \brief constructor, create the file
+         * \param fileName name of the file
+         */
+        DimacsWriter(std::string fileName);
+
+        /*!
+         * \brief constructor, write into a stream opened by the caller (a pipe for example)
+         * \param file the stream, not closed by the writer
+         */
+        DimacsWriter(std::FILE* file);
+
+        /*!
+         * \brief indicate if the output is open
+         * \return true iff the output can be written
+         */
+        bool isOpen();
+
+        /*!
+         * \brief write the header line
+         * \param nVar number of variables
+         * \param nClause number of clauses
+         */
+        void header(int nVar, int nClause);
+
+        /*!
+         * \brief write the header line at the beginning of the file with a fixed width,
+         * so that it can be written first and rewritten once the clauses are known
+         * \param nVar number of variables
+         * \param nClause number of clauses
+         */
+        void fixedHeader(int nVar, int nClause);
+
+        /*!
+         * \brief position of the end of the file
+         * \return the position, after the flushed buffer
+         */
+        long position();
+
+        /*!
+         * \brief remove the end of the file
+         * \param pos the new end of the file
+         */
+        void truncate(long pos);
+
+        /*!
+         * \brief write a literal, 0 ends the clause
+         * \param lit the literal
+         */
+        void literal(int lit);
+
+        /*!
+         * \brief write a complete clause
+         * \param begin first literal
+         * \param end after the last literal
+         */
+        void clause(const int* begin, const int* end);
+
+        /*!
+         * \brief write the content of the buffer into the output
+         */
+        void flush();
+
+        /*!
+         * \brief destructor, flush the buffer and close the file if it has been created by the writer
+         */
+        ~DimacsWriter();
+
+    private:
+
+        /*!
+         * \brief write an integer in the buffer
+         * \param val the integer
+         */
+        void integer(int val);
+
+    private:
+
+        std::FILE* _file; /* output */
+
+        bool _owner; /* the file has been opened by the writer */
+
+        char* _buffer; /* text not written yet */
+
+        std::size_t _size; /* number of characters in the buffer */
+
+};
+
+}
+
+#endif /* CNF_DIMACS_WRITER_HPP */
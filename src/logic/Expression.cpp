@@ -13,14 +13,18 @@
 #include <iostream>
 #include <stack>
 #include <list>
-
-#include "Operation.hpp"
+#include <algorithm>
+#include <cstddef>
 
 using namespace std;
 
+/* size of the memory chunks of the term arena */
+const size_t arenaChunkSize = 1 << 20;
+
 /*----------------------------------------------------------------------------*/
 Expression::Expression() :
-_term(nullptr)
+_term(nullptr),
+_chunkUsed(0)
 {
 
 }
@@ -49,12 +53,150 @@ pair<int,int> Expression::addOperation(Operation* op) {
     return pair<int,int>(termInd,static_cast<int>(_operations.size()-1));
 }
 
+/*----------------------------------------------------------------------------*/
+size_t OperationKeyHash::operator()(const vector<int>& key) const {
+    size_t res = key.size();
+    for(int val : key) {
+        res ^= hash<int>()(val) + 0x9e3779b9 + (res << 6) + (res >> 2);
+    }
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+vector<int> Expression::operationKey(int op, vector<Term*>& terms, bool commutative) {
+    vector<int> key;
+    key.reserve(terms.size()+1);
+    key.push_back(op);
+    for(auto term : terms) {
+        key.push_back(term->index());
+    }
+    if(commutative) {
+        sort(key.begin()+1, key.end());
+    }
+    return key;
+}
+
+/*----------------------------------------------------------------------------*/
+Operation* Expression::sharedOperation(vector<int>& key) {
+    auto it = _sharedOperations.find(key);
+    if(it == _sharedOperations.end()) {
+        return nullptr;
+    } else {
+        return it->second;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+AndOp* Expression::andOp(vector<Term*> terms) {
+    vector<int> key = operationKey(Operation::Operator::And, terms, true);
+    auto op = static_cast<AndOp*>(sharedOperation(key));
+    if(op == nullptr) {
+        op = new(*this) AndOp(terms);
+        _sharedOperations[key] = op;
+    }
+    return op;
+}
+
+/*----------------------------------------------------------------------------*/
+OrOp* Expression::orOp(vector<Term*> terms) {
+    vector<int> key = operationKey(Operation::Operator::Or, terms, true);
+    auto op = static_cast<OrOp*>(sharedOperation(key));
+    if(op == nullptr) {
+        op = new(*this) OrOp(terms);
+        _sharedOperations[key] = op;
+    }
+    return op;
+}
+
+/*----------------------------------------------------------------------------*/
+NotOp* Expression::notOp(Term* term) {
+    vector<Term*> terms = {term};
+    vector<int> key = operationKey(Operation::Operator::Not, terms, false);
+    auto op = static_cast<NotOp*>(sharedOperation(key));
+    if(op == nullptr) {
+        op = new(*this) NotOp(term);
+        _sharedOperations[key] = op;
+    }
+    return op;
+}
+
+/*----------------------------------------------------------------------------*/
+ImplyOp* Expression::implyOp(Term* left, Term* right) {
+    vector<Term*> terms = {left, right};
+    vector<int> key = operationKey(Operation::Operator::Imply, terms, false);
+    auto op = static_cast<ImplyOp*>(sharedOperation(key));
+    if(op == nullptr) {
+        op = new(*this) ImplyOp(left, right);
+        _sharedOperations[key] = op;
+    }
+    return op;
+}
+
 /*----------------------------------------------------------------------------*/
 int Expression::addTerm(Term* term) {
     _terms.push_back(term);
+    _nodes.push_back(TermNode());
     return static_cast<int>(_terms.size()-1);
 }
 
+/*----------------------------------------------------------------------------*/
+int Expression::literal(Term* term) {
+    return foldNot(term->index() << 1);
+}
+
+/*----------------------------------------------------------------------------*/
+int Expression::foldNot(int lit) {
+    /* not operations are folded into the complement bit */
+    while(_nodes.at(lit >> 1).op == Operation::Operator::Not) {
+        lit = _operands.at(_nodes.at(lit >> 1).begin) ^ (lit & 1) ^ 1;
+    }
+    return lit;
+}
+
+/*----------------------------------------------------------------------------*/
+void Expression::setOperands(Operation* op) {
+
+    TermNode& node = _nodes.at(op->index());
+    node.op = op->operatorType();
+    node.begin = static_cast<int>(_operands.size());
+
+    for(auto term : op->terms()) {
+        _operands.push_back(literal(term));
+    }
+
+    /* (a -> b) is stored as (not a or b) */
+    if(node.op == Operation::Operator::Imply) {
+        node.op = Operation::Operator::Or;
+        _operands.at(node.begin) ^= 1;
+    }
+
+    node.end = static_cast<int>(_operands.size());
+}
+
+/*----------------------------------------------------------------------------*/
+void Expression::updateNodes() {
+
+    _nodes.assign(_terms.size(), TermNode());
+    _operands.clear();
+
+    /* the operands may have a greater index than their operation: the not operations are stored first so they can be folded */
+    for(auto op : _operations) {
+        if(op->operatorType() == Operation::Operator::Not) {
+            TermNode& node = _nodes.at(op->index());
+            node.op = Operation::Operator::Not;
+            node.begin = static_cast<int>(_operands.size());
+            _operands.push_back(op->terms().front()->index() << 1);
+            node.end = node.begin+1;
+        }
+    }
+
+    for(auto op : _operations) {
+        if(op->operatorType() != Operation::Operator::Not) {
+            setOperands(op);
+        }
+    }
+}
+
 /*----------------------------------------------------------------------------*/
 vector<Variable*>& Expression::variables() {
     return _variables;
@@ -70,6 +212,24 @@ vector<Term*>& Expression::terms() {
     return _terms;
 }
 
+/*----------------------------------------------------------------------------*/
+void* Expression::allocate(size_t size) {
+
+    /* keep the terms aligned */
+    const size_t align = alignof(std::max_align_t);
+    size = (size + align - 1) / align * align;
+
+    if(_chunks.empty() || _chunkUsed + size > arenaChunkSize) {
+        _chunks.push_back(new char[max(size, arenaChunkSize)]);
+        _chunkUsed = 0;
+    }
+
+    void* ptr = _chunks.back() + _chunkUsed;
+    _chunkUsed += size;
+
+    return ptr;
+}
+
 /*----------------------------------------------------------------------------*/
 string Expression::toString() {
     if(_term == nullptr) {
@@ -84,11 +244,12 @@ OrOp* Expression::transformImply(ImplyOp* imply) {
 
     /* (a -> b) <-> (not a or b) */
     /* create "not a" */
-    NotOp* newNot = new NotOp(imply->terms().at(0));
-    OrOp* newOr = new OrOp({newNot, imply->terms().at(1)});
+    NotOp* newNot = new(*this) NotOp(imply->terms().at(0));
+    OrOp* newOr = new(*this) OrOp({newNot, imply->terms().at(1)});
 
     _operations.at(imply->opIndex()) = nullptr;
     _terms.at(imply->index()) = nullptr;
+    imply->releaseRef();
     delete imply;
 
     return newOr;
@@ -97,38 +258,52 @@ OrOp* Expression::transformImply(ImplyOp* imply) {
 /*----------------------------------------------------------------------------*/
 void Expression::removeImply() {
 
-    stack<Operation*> pending;
+    /* the imply operations may be shared: each one is replaced once, in all the operations using it */
+    unordered_map<Term*, OrOp*> replaced;
 
-    /* transformation for the top term */
-    if(_term->type() == Term::Type::Operation) {
-        if(dynamic_cast<Operation*>(_term)->operatorType() == Operation::Operator::Imply) {
-            _term = transformImply(dynamic_cast<ImplyOp*>(_term));
+    /* replace the operands already transformed */
+    auto update = [&replaced](Operation* op) {
+        for(unsigned int ind = 0; ind < op->terms().size(); ind ++) {
+            auto it = replaced.find(op->terms().at(ind));
+            if(it != replaced.end()) {
+                op->replaceTerm(ind, it->second);
+            }
         }
-        pending.push(dynamic_cast<Operation*>(_term));
-    }
+    };
 
-    /* transformation for sub operations */
-    while(!pending.empty()) {
-
-        Operation* top = pending.top();
-        pending.pop();
+    /* the operations created by the transformations are appended to the list and processed too */
+    for(unsigned int opInd = 0; opInd < _operations.size(); opInd ++) {
 
-        for(unsigned int ind = 0; ind < top->terms().size(); ind ++) {
+        Operation* op = _operations.at(opInd);
+        if(op == nullptr) {
+            continue;
+        }
 
-            Term* term = top->terms().at(ind);
-            if(term->type() == Term::Type::Operation) {
-                Operation* op = dynamic_cast<Operation*>(term);
-                if(op->operatorType() == Operation::Operator::Imply) {
-                    OrOp* newOr = transformImply(dynamic_cast<ImplyOp*>(op));
-                    top->terms().at(ind) = newOr;
-                    pending.push(newOr);
-                } else {
-                    pending.push(op);
-                }
+        /* an imply is transformed the first time it is found as an operand */
+        for(unsigned int ind = 0; ind < op->terms().size(); ind ++) {
+            Term* term = op->terms().at(ind);
+            auto it = replaced.find(term);
+            if(it != replaced.end()) {
+                op->replaceTerm(ind, it->second);
+            } else if(term->type() == Term::Type::Operation && static_cast<Operation*>(term)->operatorType() == Operation::Operator::Imply) {
+                auto imply = static_cast<ImplyOp*>(term);
+                update(imply);
+                OrOp* newOr = transformImply(imply);
+                replaced[term] = newOr;
+                op->replaceTerm(ind, newOr);
             }
         }
     }
 
+    /* transformation for the top term, its operands have been transformed */
+    auto it = replaced.find(_term);
+    if(it != replaced.end()) {
+        _term = it->second;
+    } else if(_term->type() == Term::Type::Operation) {
+        if(static_cast<Operation*>(_term)->operatorType() == Operation::Operator::Imply) {
+            _term = transformImply(static_cast<ImplyOp*>(_term));
+        }
+    }
 
 }
 
@@ -159,133 +334,335 @@ void Expression::updateOperationsPool() {
 /*----------------------------------------------------------------------------*/
 void Expression::reduce() {
 
+    /* the operations are modified and the indexes change: they can not be shared anymore */
+    _sharedOperations.clear();
+
     /* tranform all the imply operations into or operations */
     removeImply();
 
-    bool stop = false;
-    stack<Term*> pending;
-    pending.push(_term);
-    bool modified = false;
+    if(_term->type() == Term::Type::Operation) {
+
+        /* each operation is reduced once, before its operands: the operands merged into it are never visited */
+        vector<bool> visited(_terms.size(), false);
+        stack<Operation*> pending;
+        pending.push(static_cast<Operation*>(_term));
+        visited.at(_term->index()) = true;
+
+        while(!pending.empty()) {
+
+            Operation* top = pending.top();
+            pending.pop();
 
-    while(!stop) {
+            top->reduce();
+
+            for(auto term : top->terms()) {
+                if(term->type() == Term::Type::Operation && !visited.at(term->index())) {
+                    visited.at(term->index()) = true;
+                    pending.push(static_cast<Operation*>(term));
+                }
+            }
+        }
+    }
 
-        Term* top = pending.top();
+    /* update the operations list and the flat nodes */
+    updateOperationsPool();
+    updateNodes();
+
+}
+
+/*----------------------------------------------------------------------------*/
+void Expression::setConstant(Variable* var, bool value) {
+    _constants.push_back(pair<Variable*, bool>(var, value));
+}
+
+/*----------------------------------------------------------------------------*/
+void Expression::propagateConstants() {
+
+    _values.assign(_terms.size(), 0);
+
+    if(_constants.empty()) {
+        return;
+    }
+
+    for(auto& elt : _constants) {
+        _values.at(elt.first->index()) = (elt.second ? 1 : -1);
+    }
+
+    /* depth first from the top term: an operation is evaluated when its second visit is popped, after its operands */
+    vector<bool> visited(_terms.size(), false);
+    stack<pair<int, bool>> pending;
+    pending.push(pair<int, bool>(literal(_term) >> 1, false));
+
+    while(!pending.empty()) {
+
+        auto top = pending.top();
         pending.pop();
 
-        if(top->type() == Term::Type::Operation) {
-            if(dynamic_cast<Operation*>(top)->reduce(pending)) {
-                modified = true;
+        TermNode& node = _nodes.at(top.first);
+
+        if(!top.second) {
+            if(!visited.at(top.first) && node.op != Operation::Operator::None) {
+                visited.at(top.first) = true;
+                pending.push(pair<int, bool>(top.first, true));
+                for(int ind = node.begin; ind < node.end; ind ++) {
+                    if(!visited.at(_operands.at(ind) >> 1)) {
+                        pending.push(pair<int, bool>(_operands.at(ind) >> 1, false));
+                    }
+                }
             }
+            continue;
         }
 
-        if(pending.empty()) {
-            /* a fixed point has not been reached yet */
-            if(modified) {
-                pending.push(_term);
-                modified = false;
-            } else {
-                stop = true;
+        signed char& value = _values.at(top.first);
+
+        if(node.op == Operation::Operator::And || node.op == Operation::Operator::Or) {
+            /* absorbing value: false for and, true for or */
+            int absorbing = (node.op == Operation::Operator::And ? -1 : 1);
+            value = static_cast<signed char>(-absorbing);
+            for(int ind = node.begin; ind < node.end; ind ++) {
+                int operand = literalValue(_operands.at(ind));
+                if(operand == absorbing) {
+                    value = static_cast<signed char>(absorbing);
+                    break;
+                } else if(operand == 0) {
+                    value = 0;
+                }
+            }
+        } else if(node.op == Operation::Operator::Equivalent) {
+            int left = literalValue(_operands.at(node.begin)), right = literalValue(_operands.at(node.begin+1));
+            if(left != 0 && right != 0) {
+                value = (left == right ? 1 : -1);
             }
         }
     }
+}
 
-    /* update the operations list */
-    updateOperationsPool();
+/*----------------------------------------------------------------------------*/
+int Expression::literalValue(int lit) {
+    int value = _values.at(lit >> 1);
+    return (lit & 1) == 0 ? value : -value;
+}
 
+/*----------------------------------------------------------------------------*/
+bool Expression::addCnfLiteral(vector<int>& clause, vector<int>& cnfVar, int lit, bool polarity) {
+    int value = literalValue(lit);
+    if(value == 0) {
+        clause.push_back(cnfLiteral(cnfVar, lit, polarity));
+    }
+    /* a false literal is removed from the clause */
+    return value != (polarity ? 1 : -1);
 }
 
 /*----------------------------------------------------------------------------*/
-void Expression::creatCnfVariables(cnf::CnfExpression& cnfEx, std::vector<cnf::Variable*>& cnfVar) {
+int Expression::cnfLiteral(vector<int>& cnfVar, int lit, bool polarity) {
+    return cnf::literal(cnfVar.at(lit >> 1), polarity == ((lit & 1) == 0));
+}
 
-    cnfVar.resize(_terms.size(), nullptr);
+/*----------------------------------------------------------------------------*/
+void Expression::creatCnfVariables(cnf::CnfExpression& cnfEx, std::vector<int>& cnfVar) {
 
-    stack<Term*> pending;
+    cnfVar.resize(_terms.size(), 0);
 
-    if(_term->type() == Term::Type::Operation) {
-        for(auto term : dynamic_cast<Operation*>(_term)->terms()) {
-            pending.push(term);
+    stack<int> pending;
+
+    /* the top term has no variable unless it is a variable itself */
+    int root = literal(_term) >> 1;
+    if(_nodes.at(root).op == Operation::Operator::None) {
+        pending.push(root);
+    } else {
+        for(int ind = _nodes.at(root).begin; ind < _nodes.at(root).end; ind ++) {
+            pending.push(_operands.at(ind) >> 1);
         }
     }
 
     while(!pending.empty()) {
 
-        Term* top = pending.top();
+        int top = pending.top();
         pending.pop();
 
-        if(cnfVar.at(top->index()) == nullptr) {
+        /* the constant terms are not converted */
+        if(cnfVar.at(top) == 0 && _values.at(top) == 0) {
+            cnfVar.at(top) = cnfEx.addVariable();
+            TermNode& node = _nodes.at(top);
+            for(int ind = node.begin; ind < node.end; ind ++) {
+                pending.push(_operands.at(ind) >> 1);
+            }
+        }
 
-            if(top->type() == Term::Type::Operation) {
-                auto op = dynamic_cast<Operation*>(top);
-                if(op->operatorType() != Operation::Operator::Not) {
-                    cnfVar.at(op->index()) = new cnf::Variable(cnfEx);
-                }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void Expression::nodeToCnf(cnf::CnfExpression& cnfEx, int term, bool polarity, int gate, vector<int>& cnfVar, vector<pair<bool, bool>>& processed, stack<pair<int, bool>>& pending) {
+
+    TermNode& node = _nodes.at(term);
+
+    /* clauses of gate -> node (positive polarity) or node -> gate (negative polarity), without the gate for the top term */
+    vector<int> litList;
+    if(gate != 0) {
+        litList.push_back(cnf::literal(gate, !polarity));
+    }
 
-                for(auto term : op->terms()) {
-                    pending.push(term);
+    switch(node.op) {
+
+        case Operation::Operator::None:
+            if(gate == 0) {
+                cnfEx.addClause({cnf::literal(cnfVar.at(term), polarity)});
+            }
+            return;
+
+        case Operation::Operator::And:
+        case Operation::Operator::Or:
+            if(polarity == (node.op == Operation::Operator::And)) {
+                /* one clause per operand */
+                for(int ind = node.begin; ind < node.end; ind ++) {
+                    vector<int> clause(litList);
+                    if(addCnfLiteral(clause, cnfVar, _operands.at(ind), polarity)) {
+                        cnfEx.addClause(clause);
+                    }
                 }
             } else {
-                cnfVar.at(top->index()) = new cnf::Variable(cnfEx);
+                /* only one clause */
+                bool satisfied = false;
+                for(int ind = node.begin; ind < node.end; ind ++) {
+                    if(!addCnfLiteral(litList, cnfVar, _operands.at(ind), polarity)) {
+                        satisfied = true;
+                    }
+                }
+                if(!satisfied) {
+                    cnfEx.addClause(litList);
+                }
             }
+            for(int ind = node.begin; ind < node.end; ind ++) {
+                addPendingCnf(_operands.at(ind), polarity, processed, pending);
+            }
+            break;
+
+        case Operation::Operator::Equivalent:
+            {
+                int left = _operands.at(node.begin), right = _operands.at(node.begin+1);
+                vector<int> clause(litList);
+                if(addCnfLiteral(clause, cnfVar, left, !polarity) && addCnfLiteral(clause, cnfVar, right, true)) {
+                    cnfEx.addClause(clause);
+                }
+                if(addCnfLiteral(litList, cnfVar, left, polarity) && addCnfLiteral(litList, cnfVar, right, false)) {
+                    cnfEx.addClause(litList);
+                }
+                for(bool pol : {false, true}) {
+                    addPendingCnf(left, pol, processed, pending);
+                    addPendingCnf(right, pol, processed, pending);
+                }
+            }
+            break;
 
-        }
-
+        default:
+            break;
     }
+
 }
 
 /*----------------------------------------------------------------------------*/
-void Expression::topToCnf(vector<cnf::Variable*>& cnfVar, vector<pair<bool, bool>>& processed, stack<pair<Operation*, bool>>& pending) {
-    if(_term->type() == Term::Type::Variable) {
-        new cnf::Clause({cnf::Literal(cnfVar.at(_term->index()))});
-    } else {
-        Operation* op = dynamic_cast<Operation*>(_term);
-        op->toCnfRoot(cnfVar, processed, pending);
+void Expression::addPendingCnf(int lit, bool polarity, vector<pair<bool, bool>>& processed, stack<pair<int, bool>>& pending) {
+
+    int term = lit >> 1;
+    if(_nodes.at(term).op == Operation::Operator::None || _values.at(term) != 0) {
+        return;
+    }
+
+    /* first : negative polarity, second : positive polarity */
+    polarity = (polarity == ((lit & 1) == 0));
+    bool& done = polarity ? processed.at(term).second : processed.at(term).first;
+    if(!done) {
+        done = true;
+        pending.push(pair<int, bool>(term, polarity));
     }
 }
 
 /*----------------------------------------------------------------------------*/
-void Expression::toCnf(cnf::CnfExpression& cnfEx, vector<cnf::Variable*>& cnfVar) {
+void Expression::toCnf(cnf::CnfExpression& cnfEx, vector<int>& cnfVar) {
+
+    /* the terms fixed by the constant variables are removed */
+    propagateConstants();
 
     /* first step: create all the cnf variables */
     creatCnfVariables(cnfEx, cnfVar);
 
+    if(!_constants.empty()) {
+        /* the variables only used by removed terms keep a cnf variable, the constants are unit clauses */
+        for(auto var : _variables) {
+            if(cnfVar.at(var->index()) == 0) {
+                cnfVar.at(var->index()) = cnfEx.addVariable();
+            }
+        }
+        for(auto& elt : _constants) {
+            cnfEx.addClause({cnf::literal(cnfVar.at(elt.first->index()), elt.second)});
+        }
+    }
+
     /* list of terms already processed */
     /* first : negative polarity, second : positive polarity */
-    vector<pair<bool, bool>> processed(_operations.size());
-
-    stack<pair<Operation*, bool>> pending;
-
-    /* transform the first term */
-    topToCnf(cnfVar, processed, pending);
+    vector<pair<bool, bool>> processed(_terms.size());
+
+    stack<pair<int, bool>> pending;
+
+    /* transform the top term, a negation is a complemented literal */
+    int root = literal(_term);
+    if(literalValue(root) == 1) {
+        return;
+    } else if(literalValue(root) == -1) {
+        int var = cnfEx.addVariable();
+        cnfEx.addClause({var});
+        cnfEx.addClause({cnf::literal(var, false)});
+        return;
+    }
+    nodeToCnf(cnfEx, root >> 1, (root & 1) == 0, 0, cnfVar, processed, pending);
 
     while(!pending.empty()) {
 
-        auto inc = pending.top();
+        auto top = pending.top();
         pending.pop();
-        if(inc.first->type() == Term::Type::Operation) {
-            Operation* op = dynamic_cast<Operation*>(inc.first);
-            op->toCnf(inc.second, cnfVar, processed, pending);
-        }
+        nodeToCnf(cnfEx, top.first, top.second, cnfVar.at(top.first), cnfVar, processed, pending);
 
     }
 
-    /* display match between exp var and cnf var */
-    // cout << endl << endl;
-    // for(unsigned int i = 0; i < _terms.size(); i++) {
-    //     if(cnfVar.at(i) != nullptr) {
-    //         cout << "ex var " << _terms.at(i)->toString() << " -> cnf " << cnfVar.at(i)->toString() << endl;
-    //     }
-    // }
-    // cout << endl << endl;
-    //
-    // cout << "nbVar " << cnfEx.nVar() << endl;
-
 }
 
 /*----------------------------------------------------------------------------*/
-Expression::~Expression() {
+void Expression::clear() {
+
+    /* the destructors release the operands lists, the memory of the terms is freed with the arena */
     for(auto term : _terms) {
         if(term != nullptr) {
             delete term;
         }
     }
+
+    _term = nullptr;
+    _variables.clear();
+    _operations.clear();
+    _terms.clear();
+    _nodes.clear();
+    _operands.clear();
+    _constants.clear();
+    _values.clear();
+    _sharedOperations.clear();
+
+    /* the first chunk is reused by the next terms */
+    for(unsigned int ind = 1; ind < _chunks.size(); ind ++) {
+        delete[] _chunks.at(ind);
+    }
+    if(!_chunks.empty()) {
+        _chunks.resize(1);
+    }
+    _chunkUsed = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+Expression::~Expression() {
+
+    clear();
+
+    for(auto chunk : _chunks) {
+        delete[] chunk;
+    }
 }
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 #include <stack>
+#include <unordered_map>
 
 #include "CnfExpression.hpp"
 
@@ -18,8 +19,28 @@ class Term;
 class Variable;
 class Operation;
 class OrOp;
+class AndOp;
+class NotOp;
 class ImplyOp;
 
+/*!
+ * \struct OperationKeyHash
+ * \brief hash of an operation key: operator followed by the operand indexes
+ */
+struct OperationKeyHash {
+    std::size_t operator()(const std::vector<int>& key) const;
+};
+
+/*!
+ * \struct TermNode
+ * \brief flat storage of a term: operator and range of its operands in the operands array of the expression
+ */
+struct TermNode {
+    int op = 0; /* operator of the operation (Operation::Operator), 0 for a variable */
+    int begin = 0; /* index of the first operand */
+    int end = 0; /* index after the last operand */
+};
+
 /*!
  * \class Expression
  * \brief Represent a logical expression as a tree
@@ -60,6 +81,41 @@ class Expression {
          */
         std::pair<int,int> addOperation(Operation* op);
 
+        /*!
+         * \brief create an and operation, or return the existing one with the same operands
+         * \param terms the operands
+         * \return the and operation
+         */
+        AndOp* andOp(std::vector<Term*> terms);
+
+        /*!
+         * \brief create an or operation, or return the existing one with the same operands
+         * \param terms the operands
+         * \return the or operation
+         */
+        OrOp* orOp(std::vector<Term*> terms);
+
+        /*!
+         * \brief create a not operation, or return the existing one on the same term
+         * \param term the operand
+         * \return the not operation
+         */
+        NotOp* notOp(Term* term);
+
+        /*!
+         * \brief create an imply operation left -> right, or return the existing one
+         * \param left the left term
+         * \param right the right term
+         * \return the imply operation
+         */
+        ImplyOp* implyOp(Term* left, Term* right);
+
+        /*!
+         * \brief store the operands of a new operation in the flat nodes, the not operands are folded into the complement bit of the literals
+         * \param op the operation
+         */
+        void setOperands(Operation* op);
+
         /*!
          * \brief get the variables of the expression
          * \return the variables vector
@@ -78,6 +134,13 @@ class Expression {
          */
         std::vector<Term*>& terms();
 
+        /*!
+         * \brief allocate memory for a term in the arena of the expression, released with the expression
+         * \param size size of the memory block
+         * \return the memory block
+         */
+        void* allocate(std::size_t size);
+
         /*!
          * \brief return the expression as a string
          * \return the string
@@ -85,16 +148,28 @@ class Expression {
         std::string toString();
 
         /*!
-         * \brief reduce the ewpression : translate the "->" into "or"
+         * \brief reduce the ewpression : translate the "->" into "or", merge the nested "and" and "or" used only once, in linear time
          */
         void reduce();
 
+        /*!
+         * \brief give a constant value to a variable, the operations whose value is fixed by the constants are removed by the conversion to cnf
+         * \param var the variable
+         * \param value the value of the variable
+         */
+        void setConstant(Variable* var, bool value);
+
         /*!
          * \brief convert the formula to a cnf formula
          * \param ex the new cnf expression
-         * \param cnfVar list of all cnf variable (corresponding to the ex term id)
+         * \param cnfVar cnf variable of each term (0 if none), kept between the conversions
+         */
+        void toCnf(cnf::CnfExpression& cnfEx, std::vector<int>& cnfVar);
+
+        /*!
+         * \brief remove all the terms of the expression, their memory is reused by the next terms
          */
-        void toCnf(cnf::CnfExpression& cnfEx, std::vector<cnf::Variable*>& cnfVar);
+        void clear();
 
         /*!
          * \brief destructor, destruct all the variables and operations
@@ -111,6 +186,22 @@ class Expression {
          */
         int addTerm(Term* term);
 
+        /*!
+         * \brief compute the key identifying an operation in the shared operations table
+         * \param op the operator
+         * \param terms the operands
+         * \param commutative true if the order of the operands does not matter
+         * \return the key
+         */
+        std::vector<int> operationKey(int op, std::vector<Term*>& terms, bool commutative);
+
+        /*!
+         * \brief look for an operation in the shared operations table
+         * \param key key of the operation
+         * \return the operation, nullptr if it does not exist yet
+         */
+        Operation* sharedOperation(std::vector<int>& key);
+
         /*!
          * \brief transform implies into or
          */
@@ -133,14 +224,78 @@ class Expression {
          * \param cnfEx the cnf expression
          * \param cnfVar the list of the cnf variables
          */
-        void creatCnfVariables(cnf::CnfExpression& cnfEx, std::vector<cnf::Variable*>& cnfVar);
+        void creatCnfVariables(cnf::CnfExpression& cnfEx, std::vector<int>& cnfVar);
+
+        /*!
+         * \brief literal of a term in the flat nodes: index of the term * 2, + 1 if negated
+         * \param term the term
+         * \return the literal, the not operations are folded
+         */
+        int literal(Term* term);
+
+        /*!
+         * \brief follow the not operations of a literal
+         * \param lit the literal
+         * \return the literal of a term which is not a not operation
+         */
+        int foldNot(int lit);
+
+        /*!
+         * \brief rebuild the flat nodes from the operations
+         */
+        void updateNodes();
+
+        /*!
+         * \brief compute the value of the terms fixed by the constant variables, the operands before their operations
+         */
+        void propagateConstants();
+
+        /*!
+         * \brief value of a literal of the flat nodes, from the constant variables
+         * \param lit the literal
+         * \return 1 if the literal is true, -1 if it is false, 0 if it is unknown
+         */
+        int literalValue(int lit);
 
         /*!
-         * \brief convert the top term to a cnf expression
-         * \param pending the pending list
-         * \cnfVar the cnf variables
+         * \brief add the cnf literal of a literal of the flat nodes to a clause, unless its value is known
+         * \param clause the clause
+         * \param cnfVar the cnf variables
+         * \param lit the literal
+         * \param polarity false to negate the literal
+         * \return false if the literal is true: the clause is satisfied
          */
-        void topToCnf(std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending);
+        bool addCnfLiteral(std::vector<int>& clause, std::vector<int>& cnfVar, int lit, bool polarity);
+
+        /*!
+         * \brief create a cnf literal from a literal of the flat nodes
+         * \param cnfVar the cnf variables
+         * \param lit the literal
+         * \param polarity false to negate the literal
+         * \return the cnf literal
+         */
+        int cnfLiteral(std::vector<int>& cnfVar, int lit, bool polarity);
+
+        /*!
+         * \brief convert a node to cnf
+         * \param cnfEx the cnf expression
+         * \param term index of the term
+         * \param polarity polarity of the term
+         * \param gate cnf variable of the term, 0 for the top term
+         * \param cnfVar the cnf variables
+         * \param processed polarities already converted for each term
+         * \param pending the remaining terms to convert
+         */
+        void nodeToCnf(cnf::CnfExpression& cnfEx, int term, bool polarity, int gate, std::vector<int>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<int, bool>>& pending);
+
+        /*!
+         * \brief add an operand to the terms to convert if it has not been converted with this polarity
+         * \param lit the literal of the operand
+         * \param polarity polarity of the operation
+         * \param processed polarities already converted for each term
+         * \param pending the remaining terms to convert
+         */
+        void addPendingCnf(int lit, bool polarity, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<int, bool>>& pending);
 
     /* protected attributes */
     protected:
@@ -152,6 +307,20 @@ class Expression {
         std::vector<Operation*> _operations; /* list of all operations */
 
         std::vector<Term*> _terms; /* list of all terms */
+
+        std::vector<TermNode> _nodes; /* flat nodes of the terms, same indexes */
+
+        std::vector<int> _operands; /* operands of all the nodes, as literals */
+
+        std::vector<std::pair<Variable*, bool>> _constants; /* variables of constant value */
+
+        std::vector<signed char> _values; /* value of each term fixed by the constants: 1 true, -1 false, 0 unknown */
+
+        std::unordered_map<std::vector<int>, Operation*, OperationKeyHash> _sharedOperations; /* operations created by the factories, by operator and operands */
+
+        std::vector<char*> _chunks; /* memory chunks of the term arena */
+
+        std::size_t _chunkUsed; /* bytes used in the last chunk */
 };
 
 #endif
@@ -18,6 +18,7 @@ Operation(left->expression())
     _terms.push_back(left);
     _terms.push_back(right);
     _op = Operation::Operator::Imply;
+    storeOperands();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -29,29 +30,3 @@ string ImplyOp::toString() {
     res += ")";
     return res;
 }
-
-/*----------------------------------------------------------------------------*/
-void ImplyOp::toCnf(bool polarity, std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending) {
-
-    if(polarity) {
-        new cnf::Clause({createCnfLiteral(cnfVar, false), _terms.at(0)->createCnfLiteral(cnfVar, false), _terms.at(1)->createCnfLiteral(cnfVar, true)});
-        updatePendingCnf(processed, pending, _terms.at(0), 1);
-        updatePendingCnf(processed, pending, _terms.at(1), 2);
-    } else {
-
-        new cnf::Clause({createCnfLiteral(cnfVar, true), _terms.at(0)->createCnfLiteral(cnfVar, true)});
-        new cnf::Clause({createCnfLiteral(cnfVar, true), _terms.at(1)->createCnfLiteral(cnfVar, false)});
-
-        updatePendingCnf(processed, pending, _terms.at(0), 2);
-        updatePendingCnf(processed, pending, _terms.at(1), 1);
-    }
-
-}
-
-/*----------------------------------------------------------------------------*/
-void ImplyOp::toCnfRoot(vector<cnf::Variable*>& cnfVar, vector<std::pair<bool, bool>>& processed, stack<pair<Operation*, bool>>& pending) {
-    /* one clause : not a or b */
-    new cnf::Clause({_terms.at(0)->createCnfLiteral(cnfVar, false), _terms.at(1)->createCnfLiteral(cnfVar, true)});
-    updatePendingCnf(processed, pending, _terms.at(0), 1);
-    updatePendingCnf(processed, pending, _terms.at(1), 2);
-}
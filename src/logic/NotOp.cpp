@@ -17,6 +17,7 @@ Operation(term->expression())
 {
     _terms.push_back(term);
     _op = Operation::Operator::Not;
+    storeOperands();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -24,24 +25,3 @@ string NotOp::toString() {
     string res = "not(" + _terms.front()->toString() + ")";
     return res;
 }
-
-/*----------------------------------------------------------------------------*/
-void NotOp::toCnf(bool polarity, std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending) {
-    if(_terms.at(0)->type() == Term::Type::Operation) {
-        updatePendingCnf(processed, pending, (!polarity ? 2 : 1));
-    }
-}
-
-/*----------------------------------------------------------------------------*/
-cnf::Literal NotOp::createCnfLiteral(vector<cnf::Variable*>& cnfVar, bool polarity) {
-    /* simply invert the polarity of the sub term */
-    return cnf::Literal(cnfVar.at(_terms.at(0)->index()), !polarity);
-}
-
-/*----------------------------------------------------------------------------*/
-void NotOp::toCnfRoot(vector<cnf::Variable*>& cnfVar, vector<std::pair<bool, bool>>& processed, stack<pair<Operation*, bool>>& pending) {
-
-    /* one clause : not a */
-    new cnf::Clause({_terms.at(0)->createCnfLiteral(cnfVar, false)});
-    updatePendingCnf(processed, pending, 1);
-}
@@ -8,6 +8,7 @@
 #include "Operation.hpp"
 
 #include <iostream>
+#include <stack>
 
 using namespace std;
 
@@ -44,57 +45,92 @@ void Operation::setOpIndex(int opInd) {
 }
 
 /*----------------------------------------------------------------------------*/
-bool Operation::reduce(stack<Term*>& pending) {
-    for(auto term : _terms) {
-        pending.push(term);
-    }
+bool Operation::reduce() {
     return false;
 }
 
 /*----------------------------------------------------------------------------*/
-void Operation::updatePendingCnf(vector<pair<bool, bool>>& processed, stack<pair<Operation*, bool>>& pending, int pol) {
-
-    for(auto term : _terms) {
-        updatePendingCnf(processed, pending, term, pol);
-    }
+int Operation::nRef() {
+    return _nRef;
+}
 
+/*----------------------------------------------------------------------------*/
+void Operation::increaseRef() {
+    _nRef ++;
 }
 
 /*----------------------------------------------------------------------------*/
-void Operation::updatePendingCnf(vector<pair<bool, bool>>& processed, stack<pair<Operation*, bool>>& pending, Term* term, int pol) {
-    if(term->type() == Term::Type::Operation) {
-        Operation* op = dynamic_cast<Operation*>(term);
-
-        /* negative operations */
-        if((pol == 0 || pol == 1) && !processed.at(op->opIndex()).first) {
-            processed.at(op->opIndex()).first = true;
-            pending.push(pair<Operation*, bool>(op, false));
-        }
+bool Operation::flatten() {
+
+    bool modified = false;
+
+    /* the operands are expanded depth first, a merged operation is read once: linear in the size of the merged operations */
+    vector<Term*> terms;
+    terms.reserve(_terms.size());
+    stack<Term*> pending;
+    for(auto it = _terms.rbegin(); it != _terms.rend(); it ++) {
+        pending.push(*it);
+    }
+
+    while(!pending.empty()) {
+
+        Term* term = pending.top();
+        pending.pop();
+
+        if(term->type() == Term::Type::Operation) {
 
-        /* positive operations */
-        if((pol == 0 || pol == 2) && !processed.at(op->opIndex()).second) {
-            processed.at(op->opIndex()).second = true;
-            pending.push(pair<Operation*, bool>(op, true));
+            auto op = static_cast<Operation*>(term);
+
+            /* the references of the sub operands are transfered to this operation */
+            if(op->_op == _op && op->_nRef <= 1) {
+                modified = true;
+                for(auto it = op->_terms.rbegin(); it != op->_terms.rend(); it ++) {
+                    pending.push(*it);
+                }
+                _ex.operations().at(op->opIndex()) = nullptr;
+                _ex.terms().at(op->index()) = nullptr;
+                delete op;
+                continue;
+            }
         }
 
+        terms.push_back(term);
     }
+
+    if(modified) {
+        _terms.swap(terms);
+    }
+
+    return modified;
 }
 
 /*----------------------------------------------------------------------------*/
-short int Operation::nRef() {
-    return _nRef;
+void Operation::storeOperands() {
+    updateRef();
+    _ex.setOperands(this);
 }
 
 /*----------------------------------------------------------------------------*/
-void Operation::increaseRef() {
-    _nRef = static_cast<short int>(1+_nRef);
+void Operation::updateRef() {
+    for(Term* term : _terms) {
+        if(term->type() == Term::Type::Operation) {
+            static_cast<Operation*>(term)->increaseRef();
+        }
+    }
 }
 
 /*----------------------------------------------------------------------------*/
-void Operation::updateRef() {
+void Operation::releaseRef() {
     for(Term* term : _terms) {
         if(term->type() == Term::Type::Operation) {
-            dynamic_cast<Operation*>(term)->increaseRef();
+            auto op = static_cast<Operation*>(term);
+            op->_nRef --;
         }
     }
 }
+
+/*----------------------------------------------------------------------------*/
+void Operation::replaceTerm(unsigned int ind, Operation* op) {
+    _terms.at(ind) = op;
+    op->increaseRef();
+}
@@ -62,61 +62,47 @@ class Operation : public Term {
         void setOpIndex(int opIndex);
 
         /*!
-         * \brief reduce the sub expression
-         * \param pending the pending terms
-         * \return true if the expression has been reduced
+         * \brief reduce the operation, called before its operands are reduced
+         * \return true if the operation has been reduced
          */
-        virtual bool reduce(std::stack<Term*>& pending);
+        virtual bool reduce();
 
         /*!
-         * \brief convert the operation into a cnf formula
-         * \param polarity polarity of the operation
-         * \param cnfVar list of the cnf variables
-         * \param processed list of terms already processed
-         * \param cnfEx the cnf expression
-         * \param pending the remaining terms to transform
+         * \brief give de number of reference
+         * \return the number of ref
          */
-        virtual void toCnf(bool polarity, std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending) = 0;
+        int nRef();
 
         /*!
-         * \brief convert the operation into a cnf formula as the root of the formula
-         * \param cnfVar list of the cnf variables
-         * \param processed list of terms already processed
-         * \param cnfEx the cnf expression
-         * \param pending the remaining terms to transform
+         * \brief remove the references of this operation to its operands, before the operation is deleted
          */
-        virtual void toCnfRoot(std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending) = 0;
+        void releaseRef();
 
         /*!
-         * \brief give de number of reference
-         * \return the number of ref
+         * \brief replace an operand which has been deleted by another operation
+         * \param ind index of the operand
+         * \param op the new operand
          */
-        short int nRef();
+        void replaceTerm(unsigned int ind, Operation* op);
 
     /* protected methods */
     protected:
 
         /*!
-         * \brief update the pending list of operations to transform into cnf
-         * \param processed list of operations already processed
-         * \param pending list of remaining operations
-         * \param pol : polarity : 0: both, 1: negative, 2: positive
+         * \brief called by the constructors once the operands are known: update their number of references and store them in the flat nodes of the expression
          */
-        void updatePendingCnf(std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending, int pol);
+        void storeOperands();
 
         /*!
-         * \brief update the pending list of operations to transform into cnf, add the term term
-         * \param processed list of operations already processed
-         * \param pending list of remaining operations
-         * \param term the term to be added
-         * \param pol : polarity : 0: both, 1: negative, 2: positive
+         * \brief add a reference to this operation
          */
-        void updatePendingCnf(std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending, Term* term, int pol);
+        void increaseRef();
 
         /*!
-         * \brief add a reference to this operation
+         * \brief replace the operands with the same operator, used only by this operation, by their own operands, recursively
+         * \return true if an operand has been replaced
          */
-        void increaseRef();
+        bool flatten();
 
     /* private methods */
     private:
@@ -130,7 +116,7 @@ class Operation : public Term {
         Operator _op;
         int _opInd; /* operation index */
         std::vector<Term*> _terms; /* list of operands */
-        short int _nRef; /* number of time the operation is used */
+        int _nRef; /* number of time the operation is used */
 };
 
 /*!
@@ -149,16 +135,10 @@ class OrOp : public Operation {
 
         virtual std::string toString();
 
-        virtual bool reduce(std::stack<Term*>& pending);
-
-        virtual void toCnf(bool polarity, std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending);
-
-        virtual void toCnfRoot(std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending);
+        virtual bool reduce();
 
     protected:
 
-
-
 };
 
 /*!
@@ -177,10 +157,7 @@ class AndOp : public Operation {
 
         virtual std::string toString();
 
-        virtual void toCnf(bool polarity, std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending);
-
-        virtual void toCnfRoot(std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending);
-
+        virtual bool reduce();
 
     protected:
 
@@ -201,13 +178,6 @@ class NotOp : public Operation {
 
         virtual std::string toString();
 
-        virtual void toCnf(bool polarity, std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending);
-
-        virtual cnf::Literal createCnfLiteral(std::vector<cnf::Variable*>& cnfVar, bool polarity);
-
-        virtual void toCnfRoot(std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending);
-
-
     protected:
 
 };
@@ -229,11 +199,6 @@ class ImplyOp : public Operation {
 
         virtual std::string toString();
 
-        virtual void toCnf(bool polarity, std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending);
-
-        virtual void toCnfRoot(std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending);
-
-
     private:
 
 };
@@ -255,10 +220,6 @@ class EquivalentOp : public Operation {
 
         virtual std::string toString();
 
-        virtual void toCnf(bool polarity, std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending);
-
-        virtual void toCnfRoot(std::vector<cnf::Variable*>& cnfVar, std::vector<std::pair<bool, bool>>& processed, std::stack<std::pair<Operation*, bool>>& pending);
-
     private:
 
 };
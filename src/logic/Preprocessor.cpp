@@ -0,0 +1,402 @@
+/*!
+ * \file Preprocessor.cpp
+ * \brief implementation of the Preprocessor class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "Preprocessor.hpp"
+
+#include "../sat/Solver.hpp"
+
+using namespace std;
+using namespace cnf;
+
+/* maximal number of clauses of a variable on each side for the elimination */
+const unsigned int maxOccurrences = 16;
+
+/* maximal size of a resolvent */
+const unsigned int maxResolventSize = 16;
+
+/* maximal number of simplification rounds */
+const int maxRounds = 5;
+
+/*----------------------------------------------------------------------------*/
+/* literal order of the clauses: by variable, then negative before positive */
+static bool litLess(int lit1, int lit2) {
+    return abs(lit1) < abs(lit2) || (abs(lit1) == abs(lit2) && lit1 < lit2);
+}
+
+/*----------------------------------------------------------------------------*/
+Preprocessor::Preprocessor(CnfExpression& cnfEx):
+_nVar(cnfEx.nVar()),
+_unsat(false)
+{
+    const vector<int>& literals = cnfEx.literals();
+    const vector<size_t>& offsets = cnfEx.offsets();
+
+    for(int lit : literals) {
+        _nVar = max(_nVar, abs(lit));
+    }
+
+    _occ.resize(2*(_nVar+1));
+    _value.resize(_nVar+1, 0);
+    _frozen.resize(_nVar+1, false);
+    _eliminated.resize(_nVar+1, false);
+
+    for(size_t clause = 0; clause+1 < offsets.size(); clause ++) {
+        addClause(vector<int>(literals.begin()+offsets.at(clause), literals.begin()+offsets.at(clause+1)));
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void Preprocessor::freeze(int var) {
+    if(var <= _nVar) {
+        _frozen.at(var) = true;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+int Preprocessor::litIndex(int lit) {
+    return lit > 0 ? 2*lit : -2*lit+1;
+}
+
+/*----------------------------------------------------------------------------*/
+void Preprocessor::addClause(vector<int> clause) {
+
+    sort(clause.begin(), clause.end(), litLess);
+    clause.erase(unique(clause.begin(), clause.end()), clause.end());
+
+    for(unsigned int ind = 0; ind+1 < clause.size(); ind ++) {
+        if(clause.at(ind) == -clause.at(ind+1)) { /* tautology */
+            return;
+        }
+    }
+
+    if(clause.empty()) {
+        _unsat = true;
+        return;
+    }
+
+    if(clause.size() == 1) {
+        _units.push_back(clause.front());
+    }
+
+    int ind = static_cast<int>(_clauses.size());
+    for(int lit : clause) {
+        _occ.at(litIndex(lit)).push_back(ind);
+    }
+    _clauses.push_back(clause);
+    _removed.push_back(false);
+}
+
+/*----------------------------------------------------------------------------*/
+void Preprocessor::removeClause(int ind) {
+    /* the occurrence lists are cleaned when they are read */
+    _removed.at(ind) = true;
+    _clauses.at(ind).clear();
+    _clauses.at(ind).shrink_to_fit();
+}
+
+/*----------------------------------------------------------------------------*/
+vector<int>& Preprocessor::occurrences(int lit) {
+    vector<int>& occ = _occ.at(litIndex(lit));
+    occ.erase(remove_if(occ.begin(), occ.end(), [this](int ind) { return _removed.at(ind); }), occ.end());
+    return occ;
+}
+
+/*----------------------------------------------------------------------------*/
+void Preprocessor::assign(int lit) {
+
+    int var = abs(lit);
+
+    if(_value.at(var) != 0) {
+        if(_value.at(var) != (lit > 0 ? 1 : -1)) {
+            _unsat = true;
+        }
+        return;
+    }
+
+    _value.at(var) = (lit > 0 ? 1 : -1);
+    _stack.push_back(pair<int, vector<int>>(lit, {lit}));
+
+    /* the clauses of the literal are satisfied */
+    for(int ind : occurrences(lit)) {
+        removeClause(ind);
+    }
+
+    /* the opposite literal is removed from its clauses */
+    for(int ind : occurrences(-lit)) {
+        vector<int>& clause = _clauses.at(ind);
+        clause.erase(find(clause.begin(), clause.end(), -lit));
+        if(clause.empty()) {
+            _unsat = true;
+        } else if(clause.size() == 1) {
+            _units.push_back(clause.front());
+        }
+    }
+
+    _occ.at(litIndex(lit)).clear();
+    _occ.at(litIndex(-lit)).clear();
+}
+
+/*----------------------------------------------------------------------------*/
+void Preprocessor::propagate() {
+    while(!_units.empty() && !_unsat) {
+        int lit = _units.back();
+        _units.pop_back();
+        assign(lit);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+bool Preprocessor::pureLiterals() {
+
+    bool res = false;
+
+    for(int var = 1; var <= _nVar && !_unsat; var ++) {
+
+        if(_value.at(var) != 0 || _frozen.at(var) || _eliminated.at(var)) {
+            continue;
+        }
+
+        bool pos = !occurrences(var).empty();
+        bool neg = !occurrences(-var).empty();
+
+        if(pos != neg) {
+            assign(pos ? var : -var);
+            res = true;
+        }
+    }
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+void Preprocessor::subsumption() {
+
+    vector<int> order;
+    for(unsigned int ind = 0; ind < _clauses.size(); ind ++) {
+        if(!_removed.at(ind)) {
+            order.push_back(ind);
+        }
+    }
+    stable_sort(order.begin(), order.end(), [this](int ind1, int ind2) { return _clauses.at(ind1).size() < _clauses.at(ind2).size(); });
+
+    for(int ind : order) {
+
+        if(_removed.at(ind)) {
+            continue;
+        }
+
+        vector<int>& clause = _clauses.at(ind);
+
+        /* the clauses containing this one contain its literal with the least occurrences */
+        int best = clause.front();
+        for(int lit : clause) {
+            if(occurrences(lit).size() < occurrences(best).size()) {
+                best = lit;
+            }
+        }
+
+        vector<int> candidates = occurrences(best);
+        for(int ind2 : candidates) {
+            vector<int>& clause2 = _clauses.at(ind2);
+            if(ind2 != ind && clause2.size() >= clause.size() && includes(clause2.begin(), clause2.end(), clause.begin(), clause.end(), litLess)) {
+                removeClause(ind2);
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+bool Preprocessor::eliminate(int var) {
+
+    if(_value.at(var) != 0 || _frozen.at(var) || _eliminated.at(var)) {
+        return false;
+    }
+
+    vector<int> pos = occurrences(var);
+    vector<int> neg = occurrences(-var);
+
+    if(pos.size() > maxOccurrences || neg.size() > maxOccurrences || pos.size()+neg.size() == 0) {
+        return false;
+    }
+
+    /* the variable is eliminated if the resolvents are not more numerous than its clauses */
+    vector<vector<int>> resolvents;
+
+    for(int ind1 : pos) {
+        for(int ind2 : neg) {
+
+            vector<int> resolvent;
+            for(int lit : _clauses.at(ind1)) {
+                if(lit != var) {
+                    resolvent.push_back(lit);
+                }
+            }
+            for(int lit : _clauses.at(ind2)) {
+                if(lit != -var) {
+                    resolvent.push_back(lit);
+                }
+            }
+
+            sort(resolvent.begin(), resolvent.end(), litLess);
+            resolvent.erase(unique(resolvent.begin(), resolvent.end()), resolvent.end());
+
+            bool tautology = false;
+            for(unsigned int ind = 0; ind+1 < resolvent.size(); ind ++) {
+                if(resolvent.at(ind) == -resolvent.at(ind+1)) {
+                    tautology = true;
+                }
+            }
+
+            if(!tautology) {
+                if(resolvent.size() > maxResolventSize || resolvents.size() >= pos.size()+neg.size()) {
+                    return false;
+                }
+                resolvents.push_back(resolvent);
+            }
+        }
+    }
+
+    /* the clauses are kept to compute the value of the variable from a model */
+    for(int ind : pos) {
+        _stack.push_back(pair<int, vector<int>>(var, _clauses.at(ind)));
+        removeClause(ind);
+    }
+    for(int ind : neg) {
+        _stack.push_back(pair<int, vector<int>>(-var, _clauses.at(ind)));
+        removeClause(ind);
+    }
+    _eliminated.at(var) = true;
+
+    for(auto& resolvent : resolvents) {
+        addClause(resolvent);
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+bool Preprocessor::variableElimination() {
+
+    vector<pair<size_t, int>> order;
+    for(int var = 1; var <= _nVar; var ++) {
+        if(_value.at(var) == 0 && !_frozen.at(var) && !_eliminated.at(var)) {
+            order.push_back(pair<size_t, int>(occurrences(var).size()*occurrences(-var).size(), var));
+        }
+    }
+    sort(order.begin(), order.end());
+
+    bool res = false;
+    for(auto& elt : order) {
+        if(_unsat) {
+            break;
+        }
+        if(eliminate(elt.second)) {
+            res = true;
+            propagate();
+        }
+    }
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+bool Preprocessor::simplify() {
+
+    propagate();
+
+    bool modified = true;
+    for(int round = 0; round < maxRounds && modified && !_unsat; round ++) {
+        modified = pureLiterals();
+        propagate();
+        subsumption();
+        if(variableElimination()) {
+            modified = true;
+        }
+        propagate();
+    }
+
+    return !_unsat;
+}
+
+/*----------------------------------------------------------------------------*/
+void Preprocessor::exportClauses(sat::Solver& solver) {
+
+    if(_unsat) {
+        solver.addClause({1});
+        solver.addClause({-1});
+        return;
+    }
+
+    /* the frozen variables keep their value in the solver */
+    for(int var = 1; var <= _nVar; var ++) {
+        if(_frozen.at(var) && _value.at(var) != 0) {
+            solver.addClause({_value.at(var) > 0 ? var : -var});
+        }
+    }
+
+    for(unsigned int ind = 0; ind < _clauses.size(); ind ++) {
+        if(!_removed.at(ind)) {
+            solver.addClause(_clauses.at(ind));
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void Preprocessor::extendModel(vector<bool>& model) {
+
+    model.resize(_nVar+1, false);
+
+    /* the removed variables are unknown until a clause of the stack needs them */
+    vector<signed char> value(_nVar+1);
+    for(int var = 1; var <= _nVar; var ++) {
+        value.at(var) = model.at(var) ? 1 : -1;
+    }
+    for(auto& elt : _stack) {
+        value.at(abs(elt.first)) = 0;
+    }
+
+    for(auto it = _stack.rbegin(); it != _stack.rend(); it ++) {
+        bool satisfied = false;
+        for(int lit : it->second) {
+            if(value.at(abs(lit)) == (lit > 0 ? 1 : -1)) {
+                satisfied = true;
+                break;
+            }
+        }
+        if(!satisfied) {
+            value.at(abs(it->first)) = (it->first > 0 ? 1 : -1);
+        }
+    }
+
+    for(int var = 1; var <= _nVar; var ++) {
+        model.at(var) = (value.at(var) == 1);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+int Preprocessor::nVar() {
+    return _nVar;
+}
+
+/*----------------------------------------------------------------------------*/
+int Preprocessor::nClause() {
+    return static_cast<int>(count(_removed.begin(), _removed.end(), false));
+}
+
+/*----------------------------------------------------------------------------*/
+int Preprocessor::nRemoved() {
+    int res = 0;
+    for(int var = 1; var <= _nVar; var ++) {
+        if(_value.at(var) != 0 || _eliminated.at(var)) {
+            res ++;
+        }
+    }
+    return res;
+}
@@ -0,0 +1,164 @@
+/*!
+ * \file Preprocessor.hpp
+ * \brief simplification of a cnf formula before solving
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef CNF_PREPROCESSOR_HPP
+#define CNF_PREPROCESSOR_HPP
+
+#include <vector>
+#include <utility>
+
+#include "CnfExpression.hpp"
+
+namespace cnf {
+
+/*!
+ * \class Preprocessor
+ * \brief unit propagation, pure literal elimination, subsumption and bounded variable elimination,
+ * the removed variables are recovered from a reconstruction stack once a model is found
+ */
+class Preprocessor {
+
+    public:
+
+        /*!
+         * \brief constructor, copy the clauses of the formula
+         * \param cnfEx the formula
+         */
+        Preprocessor(CnfExpression& cnfEx);
+
+        /*!
+         * \brief forbid the elimination of a variable, used in the assumptions for example
+         * \param var the variable
+         */
+        void freeze(int var);
+
+        /*!
+         * \brief simplify the formula
+         * \return false if the formula is unsatisfiable
+         */
+        bool simplify();
+
+        /*!
+         * \brief give the simplified formula to a SAT solver
+         * \param solver the solver
+         */
+        void exportClauses(sat::Solver& solver);
+
+        /*!
+         * \brief complete a model of the simplified formula into a model of the original formula
+         * \param model value of each variable (index 0 unused), modified
+         */
+        void extendModel(std::vector<bool>& model);
+
+        /*!
+         * \brief number of variables of the formula
+         * \return the number of variables
+         */
+        int nVar();
+
+        /*!
+         * \brief number of clauses of the simplified formula
+         * \return the number of clauses
+         */
+        int nClause();
+
+        /*!
+         * \brief number of variables removed from the formula
+         * \return the number of variables
+         */
+        int nRemoved();
+
+    private:
+
+        /*!
+         * \brief index of a literal in the occurrence lists
+         * \param lit the literal
+         * \return the index
+         */
+        int litIndex(int lit);
+
+        /*!
+         * \brief add a clause to the formula: sorted, without duplicated literal, ignored if it is a tautology
+         * \param clause the clause
+         */
+        void addClause(std::vector<int> clause);
+
+        /*!
+         * \brief remove a clause from the formula
+         * \param ind index of the clause
+         */
+        void removeClause(int ind);
+
+        /*!
+         * \brief clauses of the formula containing a literal, the removed clauses are cleaned from the list
+         * \param lit the literal
+         * \return the clauses indexes
+         */
+        std::vector<int>& occurrences(int lit);
+
+        /*!
+         * \brief set a literal to true and push it on the reconstruction stack
+         * \param lit the literal
+         */
+        void assign(int lit);
+
+        /*!
+         * \brief propagate the unit clauses
+         */
+        void propagate();
+
+        /*!
+         * \brief set the pure literals to true
+         * \return true if a literal has been set
+         */
+        bool pureLiterals();
+
+        /*!
+         * \brief remove the clauses containing another clause
+         */
+        void subsumption();
+
+        /*!
+         * \brief replace the clauses of a variable by their resolvents if there are not more of them
+         * \param var the variable
+         * \return true if the variable has been eliminated
+         */
+        bool eliminate(int var);
+
+        /*!
+         * \brief try to eliminate all the variables, the variables with the least occurrences first
+         * \return true if a variable has been eliminated
+         */
+        bool variableElimination();
+
+    private:
+
+        int _nVar; /* number of variables of the formula */
+
+        std::vector<std::vector<int>> _clauses; /* clauses, literals sorted */
+
+        std::vector<bool> _removed; /* removed clauses */
+
+        std::vector<std::vector<int>> _occ; /* clauses of each literal */
+
+        std::vector<signed char> _value; /* value of each variable: 0 unknown, 1 true, -1 false */
+
+        std::vector<bool> _frozen; /* variables that cannot be removed */
+
+        std::vector<bool> _eliminated; /* variables removed by resolution */
+
+        std::vector<int> _units; /* literals to propagate */
+
+        std::vector<std::pair<int, std::vector<int>>> _stack; /* reconstruction stack: literal set to true if the clause is not satisfied */
+
+        bool _unsat; /* an empty clause has been found */
+
+};
+
+}
+
+#endif /* CNF_PREPROCESSOR_HPP */
@@ -38,11 +38,21 @@ Expression& Term::expression() {
 }
 
 /*----------------------------------------------------------------------------*/
-cnf::Literal Term::createCnfLiteral(vector<cnf::Variable*>& cnfVar, bool polarity) {
-    return cnf::Literal(cnfVar.at(_ind), polarity);
+Term::~Term() {
+
 }
 
 /*----------------------------------------------------------------------------*/
-Term::~Term() {
+void* Term::operator new(size_t size, Expression& ex) {
+    return ex.allocate(size);
+}
+
+/*----------------------------------------------------------------------------*/
+void Term::operator delete(void*, Expression&) {
+
+}
+
+/*----------------------------------------------------------------------------*/
+void Term::operator delete(void*) {
 
 }
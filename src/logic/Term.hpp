@@ -68,18 +68,30 @@ class Term {
          */
         Expression& expression();
 
-        /*!
-         * \brief create a literal for a cnf variable (used to manage the not case (no cnf variable for not operation))
-         * \param cnfVar the cnf variables
-         * \param polarity the polarity of the variable (positive or negative)
-         */
-        virtual cnf::Literal createCnfLiteral(std::vector<cnf::Variable*>& cnfVar, bool polarity);
 
         /*!
          * \brief default destructor
          */
         virtual ~Term();
 
+        /*!
+         * \brief allocate a term in the arena of an expression
+         * \param size size of the term
+         * \param ex the expression owning the memory
+         * \return the memory of the term
+         */
+        static void* operator new(std::size_t size, Expression& ex);
+
+        /*!
+         * \brief release a term whose construction failed: nothing to do, the memory belongs to the arena
+         */
+        static void operator delete(void* ptr, Expression& ex);
+
+        /*!
+         * \brief release a term: nothing to do, the memory is freed with the arena of the expression
+         */
+        static void operator delete(void* ptr);
+
     /* protected attributes */
     protected:
 
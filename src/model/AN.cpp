@@ -11,6 +11,7 @@
 
 #include <fstream>
 #include <sstream>
+#include <limits>
 
 #include "ANParser.hpp"
 
@@ -113,6 +114,17 @@ int AN::nLocalStates() {
     return res;
 }
 
+/*----------------------------------------------------------------------------*/
+int AN::nGlobalStates() {
+    long long res = 1;
+    for(int autInd = 0; autInd < _nAut; autInd ++) {
+        res *= _aut.at(autInd).nState;
+        if(res > numeric_limits<int>::max()) {
+            return -1;
+        }
+    }
+    return static_cast<int>(res);
+}
 
 /*----------------------------------------------------------------------------*/
 int AN::nTransitions() {
@@ -151,6 +163,23 @@ void AN::strContextToContext(StrContext& strCtx, Context& ctx) {
 
 }
 
+/*----------------------------------------------------------------------------*/
+string AN::contextToString(const Context& ctx) {
+
+    string res;
+
+    for(int autInd = 0; autInd < _nAut; autInd ++) {
+        if(ctx.at(autInd) != -1) {
+            if(!res.empty()) {
+                res += ",";
+            }
+            res += _aut.at(autInd).name + "=" + _aut.at(autInd).stateName.at(ctx.at(autInd));
+        }
+    }
+
+    return res;
+}
+
 /*----------------------------------------------------------------------------*/
 string AN::toString() {
 
@@ -140,6 +140,12 @@ class AN {
          */
         int nLocalStates();
 
+        /*
+         * \brief number of global states of the model: a shortest path never visits a global state twice, so it is a completeness threshold of the path length
+         * \return the number of global states, -1 if it exceeds the int range
+         */
+        int nGlobalStates();
+
         /*
          * \brief number of transitions of the model
          * \return the number of transitions
@@ -172,6 +178,13 @@ class AN {
          */
         void strContextToContext(StrContext& strCtx, Context& ctx);
 
+        /*!
+         * \brief write a context with the same format as the command line: "a=0,b=1"
+         * \param ctx the context, the automata with no local state (-1) are not written
+         * \return the string of the context
+         */
+        std::string contextToString(const Context& ctx);
+
     /* private methods */
     private:
 
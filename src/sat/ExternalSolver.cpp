@@ -0,0 +1,332 @@
+/*!
+ * \file ExternalSolver.cpp
+ * \brief implementation of the ExternalSolver class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <cstdio>
+#include <cstdlib>
+#include <cerrno>
+#include <csignal>
+
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <fcntl.h>
+
+#include "ExternalSolver.hpp"
+
+using namespace std;
+using namespace sat;
+
+/*----------------------------------------------------------------------------*/
+ExternalSolver::ExternalSolver(Parameters::Solver kind, int seed):
+_kind(kind),
+_seed(seed),
+_dimacsFile(nullptr),
+_resultFile(nullptr),
+_spool(nullptr),
+_nClause(0),
+_nVar(0),
+_pid(0)
+{
+    /* ccanr does not write a result file, its input is always a file */
+    _pipe = Parameters::getParameters().pipe && _kind != Parameters::ccanr;
+
+    /* a program killed while it reads the formula must not stop this process */
+    if(_pipe) {
+        signal(SIGPIPE, SIG_IGN);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+ExternalSolver::~ExternalSolver() {
+    delete _spool;
+    delete _dimacsFile;
+    delete _resultFile;
+}
+
+/*----------------------------------------------------------------------------*/
+void ExternalSolver::openSpool() {
+    if(_spool == nullptr) {
+        _dimacsFile = new ScratchFile();
+        _spool = new cnf::DimacsWriter(_dimacsFile->name());
+        _spool->fixedHeader(0, 0);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void ExternalSolver::add(int lit) {
+    if(_pipe) {
+        _clauses.push_back(lit);
+    } else {
+        openSpool();
+        _spool->literal(lit);
+    }
+    if(lit == 0) {
+        _nClause ++;
+    } else if(abs(lit) > _nVar) {
+        _nVar = abs(lit);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void ExternalSolver::assume(int lit) {
+    _assumptions.push_back(lit);
+    if(abs(lit) > _nVar) {
+        _nVar = abs(lit);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void ExternalSolver::exportDimacs(cnf::DimacsWriter& writer) {
+    /* the assumptions are written as unit clauses */
+    writer.header(_nVar, _nClause+static_cast<int>(_assumptions.size()));
+    for(int lit : _clauses) {
+        writer.literal(lit);
+    }
+    for(int lit : _assumptions) {
+        writer.literal(lit);
+        writer.literal(0);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+Result ExternalSolver::solve() {
+
+    Parameters& param = Parameters::getParameters();
+
+    /* the result file is kept between the calls, it is emptied before each one */
+    if(_resultFile == nullptr) {
+        _resultFile = new ScratchFile();
+    }
+    string resultFile = _resultFile->name();
+    if(!_pipe) {
+        openSpool();
+    }
+
+    /* no scratch file could be created: the solver cannot be called */
+    if(resultFile.empty() || (!_pipe && _dimacsFile->name().empty())) {
+        _assumptions.clear();
+        return Unknown;
+    }
+    if(truncate(resultFile.c_str(), 0) != 0 && param.debugLevel > 0) {
+        cout << "error, the result file " << resultFile << " cannot be emptied" << endl;
+    }
+
+    /* the assumptions are written after the clauses of the file and removed after the call */
+    long end = 0;
+    if(!_pipe) {
+        openSpool();
+        end = _spool->position();
+        for(int lit : _assumptions) {
+            _spool->literal(lit);
+            _spool->literal(0);
+        }
+        _spool->fixedHeader(_nVar, _nClause+static_cast<int>(_assumptions.size()));
+        _spool->flush();
+    }
+
+    /* arguments of the SAT solver program, it is executed without shell: the paths are never interpreted */
+    vector<string> args;
+
+    /* solver choice */
+    if(_kind == Parameters::glucose) {
+      args.push_back("./solver/glucose-syrup-4.1/simp/glucose_static");
+    } else { /* minisat anyway */
+      args.push_back("./solver/minisat/core/minisat");
+    }
+
+    if(_kind != Parameters::ccanr) {
+      if(param.debugLevel < 2) {
+        args.push_back("-verb=0");
+      }
+      if(_seed > 0) {
+        args.push_back("-rnd-seed=" + to_string(91648253 + _seed));
+        args.push_back("-rnd-freq=0.02");
+      }
+    }
+
+    if(_kind == Parameters::ccanr) {
+      args.push_back("-inst");
+    }
+
+    args.push_back(_pipe ? string("/dev/stdin") : _dimacsFile->name());
+
+    if(_kind != Parameters::ccanr) {
+      args.push_back(resultFile);
+    }
+
+    int status = execute(args);
+    _assumptions.clear();
+
+    /* minisat and glucose exit with 10 (sat) or 20 (unsat): otherwise the program has failed, been killed or run out of memory,
+       and its result file may be incomplete */
+    Result res = Unknown;
+    if(status != -1 && (_kind == Parameters::ccanr || status == 10 || status == 20)) {
+        res = readResult(resultFile);
+    }
+
+    if(!_pipe) {
+      _spool->truncate(end);
+    }
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+int ExternalSolver::execute(const vector<string>& args) {
+
+    Parameters& param = Parameters::getParameters();
+    int memory = param.memory;
+
+    /* the pipe is not inherited by the programs started at the same time by other threads: they would keep it open */
+    int fds[2] = {-1, -1};
+    if(_pipe && pipe2(fds, O_CLOEXEC) != 0) {
+        return -1;
+    }
+
+    /* the argument array is built before the fork: the child only calls async-signal-safe functions */
+    vector<char*> argv;
+    for(auto& arg : args) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    pid_t pid = fork();
+
+    if(pid == 0) {
+        /* own process group: the solver and its children are killed together */
+        setpgid(0, 0);
+        if(memory > 0) {
+            struct rlimit limit;
+            limit.rlim_cur = limit.rlim_max = static_cast<rlim_t>(memory) << 20;
+            setrlimit(RLIMIT_AS, &limit);
+        }
+        if(_pipe) {
+            dup2(fds[0], STDIN_FILENO);
+            close(fds[0]);
+            close(fds[1]);
+        }
+        /* the standard output only receives the answers (-server, -batch): the program output is only shown for debugging */
+        if(param.debugLevel < 2) {
+            int null = open("/dev/null", O_WRONLY);
+            if(null >= 0) {
+                dup2(null, STDOUT_FILENO);
+                close(null);
+            }
+        }
+        execv(argv.front(), argv.data());
+        _exit(127);
+    }
+
+    if(_pipe) {
+        close(fds[0]);
+    }
+
+    if(pid < 0) {
+        if(_pipe) {
+            close(fds[1]);
+        }
+        return -1;
+    }
+
+    setpgid(pid, pid);
+    {
+        lock_guard<mutex> lock(_mutex);
+        _pid = pid;
+    }
+
+    if(_pipe) {
+        /* the formula is streamed to the solver while it parses it, no dimacs file is written */
+        FILE* stream = fdopen(fds[1], "w");
+        if(stream != nullptr) {
+            {
+                cnf::DimacsWriter writer(stream);
+                exportDimacs(writer);
+            }
+            fclose(stream);
+        } else {
+            close(fds[1]);
+        }
+    }
+
+    /* the process is reaped once it is forgotten: interrupt never signals a process id reused by the system */
+    siginfo_t info;
+    while(waitid(P_PID, static_cast<id_t>(pid), &info, WEXITED | WNOWAIT) != 0 && errno == EINTR) {
+    }
+    {
+        lock_guard<mutex> lock(_mutex);
+        _pid = 0;
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+/*----------------------------------------------------------------------------*/
+void ExternalSolver::interrupt() {
+    lock_guard<mutex> lock(_mutex);
+    if(_pid > 0) {
+        kill(-_pid, SIGKILL);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+Result ExternalSolver::readResult(string fileName) {
+
+    Parameters& param = Parameters::getParameters();
+
+    fstream file(fileName);
+
+    if(!file) {
+      if(param.debugLevel > 0) {
+        cout << "erreur d'ouverture" << endl;
+      }
+      return Unknown;
+    }
+
+    string str;
+    file >> str;
+
+    if(param.debugLevel > 0) {
+      cout << "str: " << str << endl;
+    }
+
+    Result res = Unknown;
+
+    if(str == "UNSAT") {
+        res = Unsat;
+    } else if(str == "SAT") {
+        res = Sat;
+        _model.assign(_nVar+1, false);
+        /* the model is parsed in one pass over the content of the file, the other tokens ("v") are skipped */
+        string content((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+        const char* ptr = content.c_str();
+        while(*ptr != '\0') {
+            char* end;
+            long lit = strtol(ptr, &end, 10);
+            if(end == ptr) {
+                ptr ++;
+            } else {
+                if(lit > 0 && lit <= _nVar) {
+                    _model.at(lit) = true;
+                }
+                ptr = end;
+            }
+        }
+    }
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+bool ExternalSolver::value(int var) {
+    return var < static_cast<int>(_model.size()) && _model.at(var);
+}
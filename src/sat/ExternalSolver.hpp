@@ -0,0 +1,113 @@
+/*!
+ * \file ExternalSolver.hpp
+ * \brief SAT solver executed as an external program, through dimacs files
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef SAT_EXTERNAL_SOLVER_HPP
+#define SAT_EXTERNAL_SOLVER_HPP
+
+#include <string>
+#include <mutex>
+
+#include <sys/types.h>
+
+#include "Solver.hpp"
+
+#include "../logic/DimacsWriter.hpp"
+
+#include "ScratchFile.hpp"
+
+namespace sat {
+
+/*!
+ * \class ExternalSolver
+ * \brief write the clauses into a dimacs file as they are added and call the solver program at each solve call,
+ * with -pipe the clauses are kept in memory and written on the standard input of the program
+ */
+class ExternalSolver : public Solver {
+
+    public:
+
+        /*!
+         * \brief constructor
+         * \param kind the SAT solver program to execute
+         * \param seed diversification of the search, 0 for the default configuration
+         */
+        ExternalSolver(Parameters::Solver kind, int seed = 0);
+
+        /*!
+         * \brief destructor, remove the dimacs file
+         */
+        virtual ~ExternalSolver();
+
+        virtual void add(int lit);
+
+        virtual void assume(int lit);
+
+        virtual Result solve();
+
+        virtual bool value(int var);
+
+        /*!
+         * \brief kill the solver program if it is running
+         */
+        virtual void interrupt();
+
+    private:
+
+        /*!
+         * \brief create the dimacs file receiving the clauses, if it does not exist yet
+         */
+        void openSpool();
+
+        /*!
+         * \brief write the clauses and the assumptions in the dimacs format
+         * \param writer the output, a file or the pipe to the solver program
+         */
+        void exportDimacs(cnf::DimacsWriter& writer);
+
+        /*!
+         * \brief run the solver program and wait for its end, with -pipe the formula is written on its standard input
+         * \param args the program path and its arguments
+         * \return the exit code of the program, -1 if it has been killed
+         */
+        int execute(const std::vector<std::string>& args);
+
+        /*!
+         * \brief read the answer of the solver program
+         * \param fileName name of the result file
+         * \return the answer
+         */
+        Result readResult(std::string fileName);
+
+    private:
+
+        Parameters::Solver _kind; /* solver program */
+
+        int _seed; /* diversification of the search */
+
+        ScratchFile* _dimacsFile; /* dimacs file of the formula, nullptr until the first clause without -pipe */
+        ScratchFile* _resultFile; /* result file written by the program, nullptr until the first call */
+
+        bool _pipe; /* the formula is written on the standard input of the program */
+
+        cnf::DimacsWriter* _spool; /* dimacs file receiving the clauses as they are added, not used with -pipe */
+
+        std::vector<int> _clauses; /* literals of all the clauses, separated by 0, only with -pipe */
+        int _nClause; /* number of clauses */
+        int _nVar; /* greatest variable used */
+
+        std::vector<int> _assumptions; /* assumptions of the next call */
+
+        std::vector<bool> _model; /* values of the variables in the last model */
+
+        std::mutex _mutex; /* protect the process id */
+        pid_t _pid; /* process group of the running program, 0 if none */
+
+};
+
+}
+
+#endif /* SAT_EXTERNAL_SOLVER_HPP */
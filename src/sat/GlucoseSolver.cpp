@@ -0,0 +1,134 @@
+/*!
+ * \file GlucoseSolver.cpp
+ * \brief implementation of the GlucoseSolver class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifdef WITH_GLUCOSE
+
+#include <cstdlib>
+
+#include "core/Solver.h"
+
+#include "GlucoseSolver.hpp"
+
+using namespace std;
+using namespace sat;
+
+/*----------------------------------------------------------------------------*/
+GlucoseSolver::GlucoseSolver(int seed):
+_solver(new Glucose::Solver()),
+_outOfMemory(false)
+{
+    Parameters& param = Parameters::getParameters();
+
+    if(param.debugLevel < 2) {
+        _solver->verbosity = 0;
+    }
+
+    /* the other instances of a portfolio: random decisions and initial activities, phase saving from the seed */
+    if(seed > 0) {
+        _solver->random_seed = 91648253.0 + seed;
+        _solver->random_var_freq = 0.02;
+        _solver->rnd_init_act = true;
+        _solver->phase_saving = seed % 3;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void GlucoseSolver::reserve(int var) {
+    while(_solver->nVars() < var) {
+        _solver->newVar();
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void GlucoseSolver::add(int lit) {
+
+    if(lit != 0) {
+        _clause.push_back(lit);
+    } else {
+
+        if(!_outOfMemory) {
+            try {
+                Glucose::vec<Glucose::Lit> clause;
+                for(int elt : _clause) {
+                    reserve(abs(elt));
+                    clause.push(Glucose::mkLit(abs(elt)-1, elt < 0));
+                }
+                _solver->addClause(clause);
+            } catch(Glucose::OutOfMemoryException&) { /* the clause is lost: the next answers are unknown */
+                _outOfMemory = true;
+            }
+        }
+
+        _clause.clear();
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void GlucoseSolver::assume(int lit) {
+    _assumptions.push_back(lit);
+}
+
+/*----------------------------------------------------------------------------*/
+Result GlucoseSolver::solve() {
+
+    Glucose::vec<Glucose::Lit> assumptions;
+    try {
+        for(int lit : _assumptions) {
+            reserve(abs(lit));
+            assumptions.push(Glucose::mkLit(abs(lit)-1, lit < 0));
+        }
+    } catch(Glucose::OutOfMemoryException&) {
+        _outOfMemory = true;
+    }
+    _assumptions.clear();
+
+    Result res = Unknown;
+
+    if(_outOfMemory) { /* clauses or assumptions are missing: the answer is unknown */
+        res = Unknown;
+    } else if(_solver->okay()) {
+        /* an interruption of a previous call is ignored */
+        _solver->clearInterrupt();
+        int conflicts = Parameters::getParameters().conflicts;
+        if(conflicts > 0) {
+            _solver->setConfBudget(conflicts);
+        } else {
+            _solver->budgetOff();
+        }
+        try {
+            Glucose::lbool ret = _solver->solveLimited(assumptions);
+            if(ret == l_True) {
+                res = Sat;
+            } else if(ret == l_False) {
+                res = Unsat;
+            }
+        } catch(Glucose::OutOfMemoryException&) { /* the answer is unknown, the state of the solver is not reliable anymore */
+            _outOfMemory = true;
+        }
+    } else { /* a conflict has already been found at level 0 */
+        res = Unsat;
+    }
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+bool GlucoseSolver::value(int var) {
+    return var <= _solver->model.size() && _solver->modelValue(var-1) == l_True;
+}
+
+/*----------------------------------------------------------------------------*/
+void GlucoseSolver::interrupt() {
+    _solver->interrupt();
+}
+
+/*----------------------------------------------------------------------------*/
+GlucoseSolver::~GlucoseSolver() {
+    delete _solver;
+}
+
+#endif
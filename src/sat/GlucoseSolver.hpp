@@ -0,0 +1,70 @@
+/*!
+ * \file GlucoseSolver.hpp
+ * \brief glucose solver linked as a library
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef SAT_GLUCOSE_SOLVER_HPP
+#define SAT_GLUCOSE_SOLVER_HPP
+
+#include "Solver.hpp"
+
+namespace Glucose {
+    class Solver;
+}
+
+namespace sat {
+
+/*!
+ * \class GlucoseSolver
+ * \brief incremental calls to the glucose solver, in the same process
+ */
+class GlucoseSolver : public Solver {
+
+    public:
+
+        /*!
+         * \brief constructor
+         * \param seed diversification of the search, 0 for the default configuration
+         */
+        GlucoseSolver(int seed = 0);
+
+        virtual void add(int lit);
+
+        virtual void assume(int lit);
+
+        virtual Result solve();
+
+        virtual bool value(int var);
+
+        virtual void interrupt();
+
+        /*!
+         * \brief destructor
+         */
+        virtual ~GlucoseSolver();
+
+    private:
+
+        /*!
+         * \brief create the glucose variables up to a given variable
+         * \param var the variable
+         */
+        void reserve(int var);
+
+    private:
+
+        Glucose::Solver* _solver; /* glucose instance */
+
+        bool _outOfMemory; /* the memory has been exhausted in the solver: clauses may be missing, the answers are unknown */
+
+        std::vector<int> _clause; /* clause being added */
+
+        std::vector<int> _assumptions; /* assumptions of the next call */
+
+};
+
+}
+
+#endif /* SAT_GLUCOSE_SOLVER_HPP */
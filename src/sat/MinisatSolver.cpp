@@ -0,0 +1,134 @@
+/*!
+ * \file MinisatSolver.cpp
+ * \brief implementation of the MinisatSolver class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifdef WITH_MINISAT
+
+#include <cstdlib>
+
+#include "core/Solver.h"
+
+#include "MinisatSolver.hpp"
+
+using namespace std;
+using namespace sat;
+
+/*----------------------------------------------------------------------------*/
+MinisatSolver::MinisatSolver(int seed):
+_solver(new Minisat::Solver()),
+_outOfMemory(false)
+{
+    Parameters& param = Parameters::getParameters();
+
+    if(param.debugLevel < 2) {
+        _solver->verbosity = 0;
+    }
+
+    /* the other instances of a portfolio: random decisions and initial activities, phase saving from the seed */
+    if(seed > 0) {
+        _solver->random_seed = 91648253.0 + seed;
+        _solver->random_var_freq = 0.02;
+        _solver->rnd_init_act = true;
+        _solver->phase_saving = seed % 3;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void MinisatSolver::reserve(int var) {
+    while(_solver->nVars() < var) {
+        _solver->newVar();
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void MinisatSolver::add(int lit) {
+
+    if(lit != 0) {
+        _clause.push_back(lit);
+    } else {
+
+        if(!_outOfMemory) {
+            try {
+                Minisat::vec<Minisat::Lit> clause;
+                for(int elt : _clause) {
+                    reserve(abs(elt));
+                    clause.push(Minisat::mkLit(abs(elt)-1, elt < 0));
+                }
+                _solver->addClause(clause);
+            } catch(Minisat::OutOfMemoryException&) { /* the clause is lost: the next answers are unknown */
+                _outOfMemory = true;
+            }
+        }
+
+        _clause.clear();
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void MinisatSolver::assume(int lit) {
+    _assumptions.push_back(lit);
+}
+
+/*----------------------------------------------------------------------------*/
+Result MinisatSolver::solve() {
+
+    Minisat::vec<Minisat::Lit> assumptions;
+    try {
+        for(int lit : _assumptions) {
+            reserve(abs(lit));
+            assumptions.push(Minisat::mkLit(abs(lit)-1, lit < 0));
+        }
+    } catch(Minisat::OutOfMemoryException&) {
+        _outOfMemory = true;
+    }
+    _assumptions.clear();
+
+    Result res = Unknown;
+
+    if(_outOfMemory) { /* clauses or assumptions are missing: the answer is unknown */
+        res = Unknown;
+    } else if(_solver->okay()) {
+        /* an interruption of a previous call is ignored */
+        _solver->clearInterrupt();
+        int conflicts = Parameters::getParameters().conflicts;
+        if(conflicts > 0) {
+            _solver->setConfBudget(conflicts);
+        } else {
+            _solver->budgetOff();
+        }
+        try {
+            Minisat::lbool ret = _solver->solveLimited(assumptions);
+            if(ret == l_True) {
+                res = Sat;
+            } else if(ret == l_False) {
+                res = Unsat;
+            }
+        } catch(Minisat::OutOfMemoryException&) { /* the answer is unknown, the state of the solver is not reliable anymore */
+            _outOfMemory = true;
+        }
+    } else { /* a conflict has already been found at level 0 */
+        res = Unsat;
+    }
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+bool MinisatSolver::value(int var) {
+    return var <= _solver->model.size() && _solver->modelValue(var-1) == l_True;
+}
+
+/*----------------------------------------------------------------------------*/
+void MinisatSolver::interrupt() {
+    _solver->interrupt();
+}
+
+/*----------------------------------------------------------------------------*/
+MinisatSolver::~MinisatSolver() {
+    delete _solver;
+}
+
+#endif
@@ -0,0 +1,70 @@
+/*!
+ * \file MinisatSolver.hpp
+ * \brief minisat solver linked as a library
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef SAT_MINISAT_SOLVER_HPP
+#define SAT_MINISAT_SOLVER_HPP
+
+#include "Solver.hpp"
+
+namespace Minisat {
+    class Solver;
+}
+
+namespace sat {
+
+/*!
+ * \class MinisatSolver
+ * \brief incremental calls to the minisat solver, in the same process
+ */
+class MinisatSolver : public Solver {
+
+    public:
+
+        /*!
+         * \brief constructor
+         * \param seed diversification of the search, 0 for the default configuration
+         */
+        MinisatSolver(int seed = 0);
+
+        virtual void add(int lit);
+
+        virtual void assume(int lit);
+
+        virtual Result solve();
+
+        virtual bool value(int var);
+
+        virtual void interrupt();
+
+        /*!
+         * \brief destructor
+         */
+        virtual ~MinisatSolver();
+
+    private:
+
+        /*!
+         * \brief create the minisat variables up to a given variable
+         * \param var the variable
+         */
+        void reserve(int var);
+
+    private:
+
+        Minisat::Solver* _solver; /* minisat instance */
+
+        bool _outOfMemory; /* the memory has been exhausted in the solver: clauses may be missing, the answers are unknown */
+
+        std::vector<int> _clause; /* clause being added */
+
+        std::vector<int> _assumptions; /* assumptions of the next call */
+
+};
+
+}
+
+#endif /* SAT_MINISAT_SOLVER_HPP */
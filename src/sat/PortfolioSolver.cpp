@@ -0,0 +1,120 @@
+/*!
+ * \file PortfolioSolver.cpp
+ * \brief implementation of the PortfolioSolver class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include <thread>
+#include <chrono>
+
+#include "PortfolioSolver.hpp"
+
+using namespace std;
+using namespace sat;
+
+/* delay between two interruptions of the solvers still running after the answer */
+const chrono::milliseconds interruptDelay(10);
+
+/*----------------------------------------------------------------------------*/
+PortfolioSolver::PortfolioSolver(const vector<Parameters::Solver>& kinds):
+_nFinished(0),
+_winner(-1),
+_interrupted(false)
+{
+    for(unsigned int ind = 0; ind < kinds.size(); ind ++) {
+        /* the first solver of each kind keeps its default configuration */
+        int seed = 0;
+        for(unsigned int ind2 = 0; ind2 < ind; ind2 ++) {
+            if(kinds.at(ind2) == kinds.at(ind)) {
+                seed ++;
+            }
+        }
+        _solvers.push_back(Solver::create(kinds.at(ind), seed));
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void PortfolioSolver::add(int lit) {
+    for(auto solver : _solvers) {
+        solver->add(lit);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void PortfolioSolver::assume(int lit) {
+    for(auto solver : _solvers) {
+        solver->assume(lit);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void PortfolioSolver::run(unsigned int ind) {
+
+    Result res = _solvers.at(ind)->solve();
+
+    lock_guard<mutex> lock(_mutex);
+    _results.at(ind) = res;
+    _finished.at(ind) = true;
+    _nFinished ++;
+    if(res != Unknown && _winner == -1) {
+        _winner = static_cast<int>(ind);
+    }
+    _answer.notify_all();
+}
+
+/*----------------------------------------------------------------------------*/
+Result PortfolioSolver::solve() {
+
+    _results.assign(_solvers.size(), Unknown);
+    _finished.assign(_solvers.size(), false);
+    _nFinished = 0;
+    _winner = -1;
+    _interrupted = false;
+
+    vector<thread> threads;
+    for(unsigned int ind = 0; ind < _solvers.size(); ind ++) {
+        threads.push_back(thread(&PortfolioSolver::run, this, ind));
+    }
+
+    {
+        unique_lock<mutex> lock(_mutex);
+
+        _answer.wait(lock, [this]() { return _winner != -1 || _interrupted || _nFinished == _solvers.size(); });
+
+        /* the interruption is repeated until the solvers return: a solver clears it when its call starts */
+        while(_nFinished < _solvers.size()) {
+            for(unsigned int ind = 0; ind < _solvers.size(); ind ++) {
+                if(!_finished.at(ind)) {
+                    _solvers.at(ind)->interrupt();
+                }
+            }
+            _answer.wait_for(lock, interruptDelay);
+        }
+    }
+
+    for(auto& th : threads) {
+        th.join();
+    }
+
+    return _winner == -1 ? Unknown : _results.at(_winner);
+}
+
+/*----------------------------------------------------------------------------*/
+bool PortfolioSolver::value(int var) {
+    return _winner != -1 && _solvers.at(_winner)->value(var);
+}
+
+/*----------------------------------------------------------------------------*/
+void PortfolioSolver::interrupt() {
+    lock_guard<mutex> lock(_mutex);
+    _interrupted = true;
+    _answer.notify_all();
+}
+
+/*----------------------------------------------------------------------------*/
+PortfolioSolver::~PortfolioSolver() {
+    for(auto solver : _solvers) {
+        delete solver;
+    }
+}
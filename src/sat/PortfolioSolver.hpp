@@ -0,0 +1,74 @@
+/*!
+ * \file PortfolioSolver.hpp
+ * \brief several SAT solvers run in parallel on the same formula
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef SAT_PORTFOLIO_SOLVER_HPP
+#define SAT_PORTFOLIO_SOLVER_HPP
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+#include "Solver.hpp"
+
+namespace sat {
+
+/*!
+ * \class PortfolioSolver
+ * \brief give the clauses to all the solvers and run them in parallel at each call, one thread per solver:
+ * the first Sat or Unsat answer is kept and the other solvers are interrupted
+ */
+class PortfolioSolver : public Solver {
+
+    public:
+
+        /*!
+         * \brief constructor, the solvers of the same kind are diversified by their seed
+         * \param kinds the SAT solvers run in parallel
+         */
+        PortfolioSolver(const std::vector<Parameters::Solver>& kinds);
+
+        virtual void add(int lit);
+
+        virtual void assume(int lit);
+
+        virtual Result solve();
+
+        virtual bool value(int var);
+
+        virtual void interrupt();
+
+        /*!
+         * \brief destructor, delete the solvers
+         */
+        virtual ~PortfolioSolver();
+
+    private:
+
+        /*!
+         * \brief run a solver, called by its thread
+         * \param ind index of the solver
+         */
+        void run(unsigned int ind);
+
+    private:
+
+        std::vector<Solver*> _solvers; /* the solvers of the portfolio */
+
+        std::mutex _mutex; /* protect the state of the current call */
+        std::condition_variable _answer; /* a solver has answered */
+
+        std::vector<Result> _results; /* answer of each solver in the current call */
+        std::vector<bool> _finished; /* the solver has answered in the current call */
+        unsigned int _nFinished; /* number of solvers which have answered */
+        int _winner; /* index of the first solver with a definitive answer, -1 if none */
+        bool _interrupted; /* the current call has been interrupted from outside */
+
+};
+
+}
+
+#endif /* SAT_PORTFOLIO_SOLVER_HPP */
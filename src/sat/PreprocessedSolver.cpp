@@ -0,0 +1,102 @@
+/*!
+ * \file PreprocessedSolver.cpp
+ * \brief implementation of the PreprocessedSolver class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include <iostream>
+#include <cstdlib>
+
+#include "PreprocessedSolver.hpp"
+
+using namespace std;
+using namespace sat;
+
+/*----------------------------------------------------------------------------*/
+PreprocessedSolver::PreprocessedSolver(Solver* solver):
+_solver(solver),
+_preprocessor(nullptr)
+{
+
+}
+
+/*----------------------------------------------------------------------------*/
+void PreprocessedSolver::add(int lit) {
+
+    if(_preprocessor != nullptr) {
+        _solver->add(lit);
+        return;
+    }
+
+    if(lit != 0) {
+        _clause.push_back(lit);
+    } else {
+        _cnfEx.addClause(_clause);
+        _clause.clear();
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+void PreprocessedSolver::assume(int lit) {
+    _assumptions.push_back(lit);
+}
+
+/*----------------------------------------------------------------------------*/
+Result PreprocessedSolver::solve() {
+
+    Parameters& param = Parameters::getParameters();
+
+    if(_preprocessor == nullptr) {
+
+        _preprocessor = new cnf::Preprocessor(_cnfEx);
+
+        /* the assumed variables stay in the formula */
+        for(int lit : _assumptions) {
+            _preprocessor->freeze(abs(lit));
+        }
+
+        _preprocessor->simplify();
+        _preprocessor->exportClauses(*_solver);
+
+        if(param.debugLevel > 0) {
+            cout << "preprocessing: " << _cnfEx.nClause() << " clauses -> " << _preprocessor->nClause() << " clauses, " << _preprocessor->nRemoved() << " variables removed" << endl;
+        }
+
+        /* the clauses are now in the preprocessor and the solver */
+        _cnfEx = cnf::CnfExpression();
+    }
+
+    for(int lit : _assumptions) {
+        _solver->assume(lit);
+    }
+    _assumptions.clear();
+
+    Result res = _solver->solve();
+
+    if(res == Sat) {
+        _model.assign(_preprocessor->nVar()+1, false);
+        for(int var = 1; var <= _preprocessor->nVar(); var ++) {
+            _model.at(var) = _solver->value(var);
+        }
+        _preprocessor->extendModel(_model);
+    }
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+bool PreprocessedSolver::value(int var) {
+    return var < static_cast<int>(_model.size()) && _model.at(var);
+}
+
+/*----------------------------------------------------------------------------*/
+void PreprocessedSolver::interrupt() {
+    _solver->interrupt();
+}
+
+/*----------------------------------------------------------------------------*/
+PreprocessedSolver::~PreprocessedSolver() {
+    delete _preprocessor;
+    delete _solver;
+}
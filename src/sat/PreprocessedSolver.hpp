@@ -0,0 +1,67 @@
+/*!
+ * \file PreprocessedSolver.hpp
+ * \brief SAT solver called on the formula simplified by the cnf preprocessor
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef SAT_PREPROCESSED_SOLVER_HPP
+#define SAT_PREPROCESSED_SOLVER_HPP
+
+#include "Solver.hpp"
+
+#include "../logic/CnfExpression.hpp"
+#include "../logic/Preprocessor.hpp"
+
+namespace sat {
+
+/*!
+ * \class PreprocessedSolver
+ * \brief keep the clauses until the first solve call, simplify them and give the result to another solver,
+ * the values of the removed variables are computed from the model of the simplified formula.
+ * The formula must be complete at the first call: the clauses added afterwards are given to the solver as they are
+ */
+class PreprocessedSolver : public Solver {
+
+    public:
+
+        /*!
+         * \brief constructor
+         * \param solver the solver called on the simplified formula, deleted with this one
+         */
+        PreprocessedSolver(Solver* solver);
+
+        virtual void add(int lit);
+
+        virtual void assume(int lit);
+
+        virtual Result solve();
+
+        virtual bool value(int var);
+
+        virtual void interrupt();
+
+        /*!
+         * \brief destructor
+         */
+        virtual ~PreprocessedSolver();
+
+    private:
+
+        Solver* _solver; /* solver of the simplified formula */
+
+        cnf::CnfExpression _cnfEx; /* clauses before the first call */
+
+        cnf::Preprocessor* _preprocessor; /* created at the first call */
+
+        std::vector<int> _clause; /* clause being added */
+
+        std::vector<int> _assumptions; /* assumptions of the next call */
+
+        std::vector<bool> _model; /* model of the original formula */
+
+};
+
+}
+
+#endif /* SAT_PREPROCESSED_SOLVER_HPP */
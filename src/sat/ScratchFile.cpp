@@ -0,0 +1,100 @@
+/*!
+ * \file ScratchFile.cpp
+ * \brief implementation of the ScratchFile class
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <set>
+#include <mutex>
+
+#include <unistd.h>
+
+#include "ScratchFile.hpp"
+
+using namespace std;
+using namespace sat;
+
+/* files not removed yet: they are removed when the program calls exit without destroying them */
+static mutex scratchMutex;
+static set<string> scratchFiles;
+
+/*----------------------------------------------------------------------------*/
+static void removeScratchFiles() {
+    lock_guard<mutex> lock(scratchMutex);
+    for(auto& name : scratchFiles) {
+        remove(name.c_str());
+    }
+    scratchFiles.clear();
+}
+
+/*----------------------------------------------------------------------------*/
+ScratchFile::ScratchFile() {
+
+    vector<string> directories;
+    const char* tmpDir = getenv("TMPDIR");
+    if(tmpDir != nullptr && *tmpDir != '\0') {
+        directories.push_back(tmpDir);
+    }
+    directories.push_back("/dev/shm");
+    directories.push_back("/tmp");
+    directories.push_back(".");
+
+    for(auto& directory : directories) {
+        string pattern = directory + "/aan_reach_XXXXXX";
+        vector<char> path(pattern.begin(), pattern.end());
+        path.push_back('\0');
+        int fd = mkstemp(path.data());
+        if(fd != -1) {
+            close(fd);
+            _name = path.data();
+            break;
+        }
+    }
+
+    if(_name.empty()) {
+        /* the standard output only receives the answers with -server and -batch */
+        cerr << "error, no scratch file can be created (TMPDIR, /dev/shm, /tmp and the working directory)" << endl;
+        return;
+    }
+
+    static bool registered = false;
+    lock_guard<mutex> lock(scratchMutex);
+    if(!registered) {
+        atexit(removeScratchFiles);
+        registered = true;
+    }
+    scratchFiles.insert(_name);
+}
+
+/*----------------------------------------------------------------------------*/
+ScratchFile::~ScratchFile() {
+    if(!_name.empty()) {
+        remove(_name.c_str());
+        lock_guard<mutex> lock(scratchMutex);
+        scratchFiles.erase(_name);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+const string& ScratchFile::name() {
+    return _name;
+}
+
+/*----------------------------------------------------------------------------*/
+string ScratchFile::quotedName() {
+    /* single quotes: only the single quotes of the path have to be escaped */
+    string res = "'";
+    for(char c : _name) {
+        if(c == '\'') {
+            res += "'\\''";
+        } else {
+            res += c;
+        }
+    }
+    return res + "'";
+}
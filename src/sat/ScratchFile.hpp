@@ -0,0 +1,67 @@
+/*!
+ * \file ScratchFile.hpp
+ * \brief class ScratchFile, temporary file exchanged with an external solver program
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef SAT_SCRATCH_FILE_HPP
+#define SAT_SCRATCH_FILE_HPP
+
+#include <string>
+
+namespace sat {
+
+/*!
+ * \class ScratchFile
+ * \brief empty file with a unique name, created in memory (tmpfs) when possible and removed with the object
+ *
+ * The directory is $TMPDIR if it is set, /dev/shm otherwise, then /tmp and the working directory if they cannot be written.
+ * The names are reserved by mkstemp: several processes and threads can share the same directory.
+ * The files still existing when the program calls exit are removed, a process killed by a signal leaves them.
+ */
+class ScratchFile {
+
+    public:
+
+        /*!
+         * \brief constructor: create the file
+         */
+        ScratchFile();
+
+        /*!
+         * \brief destructor: remove the file
+         */
+        ~ScratchFile();
+
+        /*!
+         * \brief copy constructor: deleted, the file is removed once
+         */
+        ScratchFile(ScratchFile const&) = delete;
+
+        /*!
+         * \brief affectation: deleted
+         */
+        void operator=(ScratchFile const&) = delete;
+
+        /*!
+         * \brief get the path of the file
+         * \return the path, empty if no file could be created
+         */
+        const std::string& name();
+
+        /*!
+         * \brief get the path of the file quoted for a shell command line
+         * \return the path between single quotes
+         */
+        std::string quotedName();
+
+    private:
+
+        std::string _name; /* path of the file */
+
+};
+
+}
+
+#endif /* SAT_SCRATCH_FILE_HPP */
@@ -0,0 +1,80 @@
+/*!
+ * \file Solver.cpp
+ * \brief implementation of the SAT solver interface
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#include "Solver.hpp"
+#include "ExternalSolver.hpp"
+
+#ifdef WITH_MINISAT
+#include "MinisatSolver.hpp"
+#endif
+
+#ifdef WITH_GLUCOSE
+#include "GlucoseSolver.hpp"
+#endif
+
+using namespace std;
+using namespace sat;
+
+#ifdef WITH_MINISAT
+static const bool minisatLinked = true;
+#else
+static const bool minisatLinked = false;
+#endif
+
+#ifdef WITH_GLUCOSE
+static const bool glucoseLinked = true;
+#else
+static const bool glucoseLinked = false;
+#endif
+
+/*----------------------------------------------------------------------------*/
+Solver* Solver::create(Parameters::Solver kind, int seed) {
+
+    Solver* solver = nullptr;
+
+    #ifdef WITH_GLUCOSE
+    if(kind == Parameters::glucose) {
+        solver = new GlucoseSolver(seed);
+    }
+    #endif
+
+    #ifdef WITH_MINISAT
+    if(kind == Parameters::minisat) {
+        solver = new MinisatSolver(seed);
+    }
+    #endif
+
+    /* the solver is not linked: run it as an external program */
+    if(solver == nullptr) {
+        solver = new ExternalSolver(kind, seed);
+    }
+
+    return solver;
+}
+
+/*----------------------------------------------------------------------------*/
+bool Solver::linked(Parameters::Solver kind) {
+    return (kind == Parameters::minisat && minisatLinked) || (kind == Parameters::glucose && glucoseLinked);
+}
+
+/*----------------------------------------------------------------------------*/
+void Solver::addClause(const vector<int>& lits) {
+    for(int lit : lits) {
+        add(lit);
+    }
+    add(0);
+}
+
+/*----------------------------------------------------------------------------*/
+void Solver::interrupt() {
+
+}
+
+/*----------------------------------------------------------------------------*/
+Solver::~Solver() {
+
+}
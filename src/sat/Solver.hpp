@@ -0,0 +1,90 @@
+/*!
+ * \file Solver.hpp
+ * \brief incremental SAT solver interface (IPASIR-like)
+ * \author S.B
+ * \date 17/10/2026
+ */
+
+#ifndef SAT_SOLVER_HPP
+#define SAT_SOLVER_HPP
+
+#include <vector>
+
+#include "../interface/Parameters.hpp"
+
+namespace sat {
+
+/*!
+ * \brief answer of a SAT solver call
+ */
+enum Result { Sat, Unsat, Unknown };
+
+/*!
+ * \class Solver
+ * \brief incremental SAT solver: clauses are added literal by literal (DIMACS-like signed integers, 0 ends a clause)
+ */
+class Solver {
+
+    public:
+
+        /*!
+         * \brief create a solver, linked as a library when available, external process otherwise
+         * \param kind the SAT solver chosen
+         * \param seed diversification of the search (random seed and decisions), 0 for the default configuration of the solver
+         * \return the new solver
+         */
+        static Solver* create(Parameters::Solver kind, int seed = 0);
+
+        /*!
+         * \brief tell if a solver is linked as a library, it is then called in the same process
+         * \param kind the SAT solver
+         * \return true iff the solver is linked
+         */
+        static bool linked(Parameters::Solver kind);
+
+        /*!
+         * \brief add a literal to the current clause, 0 terminates the clause
+         * \param lit the literal
+         */
+        virtual void add(int lit) = 0;
+
+        /*!
+         * \brief add a complete clause
+         * \param lits the literals of the clause
+         */
+        void addClause(const std::vector<int>& lits);
+
+        /*!
+         * \brief assume a literal for the next solve call only
+         * \param lit the literal
+         */
+        virtual void assume(int lit) = 0;
+
+        /*!
+         * \brief solve the formula under the current assumptions, the assumptions are then cleared
+         * \return the answer of the solver
+         */
+        virtual Result solve() = 0;
+
+        /*!
+         * \brief value of a variable in the last model found
+         * \param var the variable (positive integer)
+         * \return true iff the variable is assigned to true
+         */
+        virtual bool value(int var) = 0;
+
+        /*!
+         * \brief stop the current solve call as soon as possible, it then answers Unknown; may be called from another thread
+         */
+        virtual void interrupt();
+
+        /*!
+         * \brief destructor
+         */
+        virtual ~Solver();
+
+};
+
+}
+
+#endif /* SAT_SOLVER_HPP */